@@ -60,13 +60,6 @@ namespace algorithms
         // assert source is in proper range
         // assert parent_list ScalarType is grb::IndexType
 
-        // create index ramp for index_of() functionality
-        grb::Vector<grb::IndexType> index_ramp(N);
-        for (grb::IndexType i = 0; i < N; ++i)
-        {
-            index_ramp.setElement(i, i);
-        }
-
         // initialize wavefront to source node.
         grb::Vector<grb::IndexType> wavefront(N);
         wavefront.setElement(source, 1UL);
@@ -78,18 +71,19 @@ namespace algorithms
         while (wavefront.nvals() > 0)
         {
             // convert all stored values to their column index
-            grb::eWiseMult(wavefront,
-                           grb::NoMask(), grb::NoAccumulate(),
-                           grb::First<grb::IndexType>(),
-                           index_ramp, wavefront);
+            grb::apply(wavefront,
+                       grb::NoMask(), grb::NoAccumulate(),
+                       grb::RowIndex<grb::IndexType>(),
+                       wavefront);
 
             // First because we are left multiplying wavefront rows
+            // Any because any neighbor in the wavefront is a valid parent
             // Masking out the parent list ensures wavefront values do not
             // overlap values already stored in the parent list
             grb::vxm(wavefront,
                      grb::complement(grb::structure(parent_list)),
                      grb::NoAccumulate(),
-                     grb::MinFirstSemiring<grb::IndexType>(),
+                     grb::AnyFirstSemiring<grb::IndexType>(),
                      wavefront, graph, grb::REPLACE);
 
             // We don't need to mask here since we did it in mxm.
@@ -127,46 +121,33 @@ namespace algorithms
              ParentListVectorT      &parent_list)
     {
         using T = typename MatrixT::ScalarType;
-        grb::IndexType const N(graph.nrows());
 
         // assert parent_list is N-vector
         // assert wavefront is N-vector
         // assert parent_list ScalarType is grb::IndexType
 
-        // create index ramp for index_of() functionality
-        grb::Vector<grb::IndexType> index_ramp(N);
-        for (grb::IndexType i = 0; i < N; ++i)
-        {
-            index_ramp.setElement(i, i);
-        }
-
         // Set the roots parents to themselves using indices
-        grb::eWiseMult(parent_list,
-                       grb::NoMask(), grb::NoAccumulate(),
-                       grb::First<grb::IndexType>(),
-                       index_ramp, wavefront);
-
-        // convert all stored values to their column index
-        grb::eWiseMult(parent_list,
-                       grb::NoMask(), grb::NoAccumulate(),
-                       grb::First<grb::IndexType>(),
-                       index_ramp, parent_list);
+        grb::apply(parent_list,
+                   grb::NoMask(), grb::NoAccumulate(),
+                   grb::RowIndex<grb::IndexType>(),
+                   wavefront);
 
         while (wavefront.nvals() > 0)
         {
             // convert all stored values to their column index
-            grb::eWiseMult(wavefront,
-                           grb::NoMask(), grb::NoAccumulate(),
-                           grb::First<grb::IndexType>(),
-                           index_ramp, wavefront);
+            grb::apply(wavefront,
+                       grb::NoMask(), grb::NoAccumulate(),
+                       grb::RowIndex<grb::IndexType>(),
+                       wavefront);
 
             // First because we are left multiplying wavefront rows
+            // Any because any neighbor in the wavefront is a valid parent
             // Masking out the parent list ensures wavefront values do not
             // overlap values already stored in the parent list
             grb::vxm(wavefront,
                      grb::complement(grb::structure(parent_list)),
                      grb::NoAccumulate(),
-                     grb::MinFirstSemiring<T>(),
+                     grb::AnyFirstSemiring<T>(),
                      wavefront, graph, grb::REPLACE);
 
             // We don't need to mask here since we did it in mxm.
@@ -205,32 +186,24 @@ namespace algorithms
                    ParentListMatrixT      &parent_list)
     {
         using T = typename MatrixT::ScalarType;
-        grb::IndexType const N(graph.nrows());
 
         // assert parent_list is RxN
         // assert wavefront is RxN
         // assert parent_list ScalarType is grb::IndexType
 
-        // create index ramp for index_of() functionality
-        grb::Matrix<grb::IndexType> index_ramp(N, N);
-        for (grb::IndexType idx = 0; idx < N; ++idx)
-        {
-            index_ramp.setElement(idx, idx, idx);
-        }
-
         // Set the roots parents to themselves.
-        grb::mxm(parent_list,
-                 grb::NoMask(), grb::NoAccumulate(),
-                 grb::MinSecondSemiring<T>(),
-                 wavefronts, index_ramp);
+        grb::apply(parent_list,
+                   grb::NoMask(), grb::NoAccumulate(),
+                   grb::ColIndex<T>(),
+                   wavefronts);
 
         while (wavefronts.nvals() > 0)
         {
             // convert all stored values to their column index
-            grb::mxm(wavefronts,
-                     grb::NoMask(), grb::NoAccumulate(),
-                     grb::MinSecondSemiring<T>(),
-                     wavefronts, index_ramp);
+            grb::apply(wavefronts,
+                       grb::NoMask(), grb::NoAccumulate(),
+                       grb::ColIndex<T>(),
+                       wavefronts);
 
             // First because we are left multiplying wavefront rows
             // Masking out the parent list ensures wavefronts values do not
@@ -294,9 +267,10 @@ namespace algorithms
                                  std::placeholders::_1),
                        wavefront);
 
+            // Only reachability matters: structure-only ANY-PAIR semiring
             grb::mxv(wavefront, complement(levels),
                      grb::NoAccumulate(),
-                     grb::LogicalSemiring<bool>(),
+                     grb::AnyPairSemiring<bool>(),
                      transpose(graph), wavefront, grb::REPLACE);
         }
     }
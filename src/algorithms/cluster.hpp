@@ -104,18 +104,19 @@ namespace algorithms
         grb::IndexType num_clusters(cluster_matrix.nrows());
         grb::IndexType num_nodes(cluster_matrix.ncols());
 
-        grb::Vector<grb::IndexType> clusters(num_nodes);
-        grb::Vector<grb::IndexType> index_of_vec(num_clusters);
-        for (grb::IndexType ix=0; ix<num_clusters; ++ix)
-        {
-            index_of_vec.setElement(ix, ix);
-        }
+        // label each stored value with its cluster (row) index
+        grb::Matrix<grb::IndexType> cluster_ids(num_clusters, num_nodes);
+        grb::apply(cluster_ids,
+                   grb::NoMask(), grb::NoAccumulate(),
+                   grb::RowIndex<grb::IndexType>(),
+                   cluster_matrix);
 
-        // return a grb::Vector with cluster assignments
-        grb::vxm(clusters,
-                 grb::NoMask(), grb::NoAccumulate(),
-                 grb::MaxFirstSemiring<grb::IndexType>(),
-                 index_of_vec, cluster_matrix);
+        // return a grb::Vector with cluster assignments (max cluster index)
+        grb::Vector<grb::IndexType> clusters(num_nodes);
+        grb::reduce(clusters,
+                    grb::NoMask(), grb::NoAccumulate(),
+                    grb::Max<grb::IndexType>(),
+                    grb::transpose(cluster_ids));
 
         return clusters;
     }
@@ -253,7 +253,6 @@ namespace algorithms
         MatrixT                     const &graph,
         grb::IndexType                     source,
         grb::IndexType                     sink,
-        grb::Vector<grb::IndexType> const &index_ramp,
         grb::Matrix<bool>                 &M)
     {
         using T = typename MatrixT::ScalarType;
@@ -266,10 +265,10 @@ namespace algorithms
         while ((!parent_list.hasElement(sink)) && (wavefront.nvals() > 0))
         {
             // convert all stored values to their column index
-            grb::eWiseMult(wavefront,
-                           grb::NoMask(), grb::NoAccumulate(),
-                           grb::First<grb::IndexType>(),
-                           index_ramp, wavefront);
+            grb::apply(wavefront,
+                       grb::NoMask(), grb::NoAccumulate(),
+                       grb::RowIndex<grb::IndexType>(),
+                       wavefront);
 
             // First because we are left multiplying wavefront rows
             // Masking out the parent list ensures wavefront values do not
@@ -317,18 +316,6 @@ namespace algorithms
 
         // @todo assert graph matrix is square
 
-        // create index ramp for index_of() functionality
-        grb::Vector<grb::IndexType> index_ramp(num_nodes);
-        {
-            std::vector<grb::IndexType> idx(num_nodes);
-            for (grb::IndexType i = 0; i < num_nodes; ++i)
-            {
-                idx[i] = i;
-            }
-
-            index_ramp.build(idx.begin(), idx.begin(), num_nodes);
-        }
-
         grb::Matrix<bool> M(num_nodes, num_nodes);
         MatrixT F(num_nodes, num_nodes);
         MatrixT R = graph;
@@ -340,7 +327,7 @@ namespace algorithms
         //grb::print_matrix(std::cerr, graph, "graph");
 
         grb::IndexType count(0);
-        while (maxflow_bfs(R, source, sink, index_ramp, M) &&
+        while (maxflow_bfs(R, source, sink, M) &&
                count++ < graph.nvals())
         {
             //std::cerr << "----------- Iteration: " << count << " -----------\n";
@@ -321,24 +321,14 @@ namespace algorithms
 
         // AL = A .* (A <= delta)
         MatrixT AL(n, n);
-        grb::apply(AL, grb::NoMask(), grb::NoAccumulate(),
-                   std::bind(grb::LessEqual<T>(),
-                             std::placeholders::_1,
-                             static_cast<T>(delta)),
-                   graph);
-        grb::apply(AL, AL, grb::NoAccumulate(),
-                   grb::Identity<T>(), graph, grb::REPLACE);
+        grb::select(AL, grb::NoMask(), grb::NoAccumulate(),
+                    grb::ValueLessEqual<T>(static_cast<T>(delta)), graph);
         //grb::print_matrix(std::cerr, AL, "AL = A(<=delta)");
 
         // AH = A .* (A > delta)
         MatrixT AH(n, n);
-        grb::apply(AH, grb::NoMask(), grb::NoAccumulate(),
-                   std::bind(grb::GreaterThan<T>(),
-                             std::placeholders::_1,
-                             delta),
-                   graph);
-        grb::apply(AH, AH, grb::NoAccumulate(),
-                   grb::Identity<T>(), graph, grb::REPLACE);
+        grb::select(AH, grb::NoMask(), grb::NoAccumulate(),
+                    grb::ValueGreaterThan<T>(static_cast<T>(delta)), graph);
         //grb::print_matrix(std::cerr, AH, "AH = A(>delta)");
 
         // i = 0
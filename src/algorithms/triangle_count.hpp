@@ -96,14 +96,11 @@ namespace algorithms
                                                        MatrixT const &U)
     {
         using T = typename MatrixT::ScalarType;
-        grb::IndexType rows(L.nrows());
-        grb::IndexType cols(L.ncols());
-
-        MatrixT B(rows, cols);
-        grb::mxm(B, L, grb::NoAccumulate(), grb::ArithmeticSemiring<T>(), L, U);
 
+        // Fused: L.*(L +.* U) is never stored
         T sum = 0;
-        grb::reduce(sum, grb::NoAccumulate(), grb::PlusMonoid<T>(), B);
+        grb::mxm_reduce(sum, L, grb::PlusMonoid<T>(),
+                        grb::ArithmeticSemiring<T>(), L, U);
         return sum;
     }
 
@@ -116,15 +113,11 @@ namespace algorithms
     typename MatrixT::ScalarType triangle_count_masked(MatrixT const &L)
     {
         using T = typename MatrixT::ScalarType;
-        grb::IndexType rows(L.nrows());
-        grb::IndexType cols(L.ncols());
-
-        MatrixT B(rows, cols);
-        grb::mxm(B, L, grb::NoAccumulate(),
-                 grb::ArithmeticSemiring<T>(), L, grb::transpose(L));
 
+        // Fused: only the masked dot products are computed, nothing stored
         T sum = 0;
-        grb::reduce(sum, grb::NoAccumulate(), grb::PlusMonoid<T>(), B);
+        grb::mxm_reduce(sum, L, grb::PlusMonoid<T>(),
+                        grb::ArithmeticSemiring<T>(), L, grb::transpose(L));
         return sum;
     }
 
@@ -137,14 +130,11 @@ namespace algorithms
     typename MatrixT::ScalarType triangle_count_masked_noT(MatrixT const &L)
     {
         using T = typename MatrixT::ScalarType;
-        grb::IndexType rows(L.nrows());
-        grb::IndexType cols(L.ncols());
-
-        MatrixT B(rows, cols);
-        grb::mxm(B, L, grb::NoAccumulate(), grb::ArithmeticSemiring<T>(), L, L);
 
+        // Fused: L.*(L +.* L) is never stored
         T sum = 0;
-        grb::reduce(sum, grb::NoAccumulate(), grb::PlusMonoid<T>(), B);
+        grb::mxm_reduce(sum, L, grb::PlusMonoid<T>(),
+                        grb::ArithmeticSemiring<T>(), L, L);
         return sum;
     }
 
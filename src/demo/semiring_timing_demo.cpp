@@ -0,0 +1,221 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * DM20-0442
+ */
+
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <random>
+
+#include <graphblas/graphblas.hpp>
+#include "Timer.hpp"
+
+using namespace grb;
+
+//****************************************************************************
+// Same algebra as LogicalSemiring and ArithmeticSemiring, but not recognized
+// by the semiring traits so the backend uses the generic kernels.
+namespace
+{
+    GEN_GRAPHBLAS_SEMIRING(GenericOrAndSemiring, LogicalOrMonoid, LogicalAnd)
+    GEN_GRAPHBLAS_SEMIRING(GenericPlusTimesSemiring, PlusMonoid, Times)
+}
+
+//****************************************************************************
+IndexType read_edge_list(std::string const &pathname,
+                         IndexArrayType    &row_indices,
+                         IndexArrayType    &col_indices)
+{
+    std::ifstream infile(pathname);
+    IndexType max_id = 0;
+    uint64_t num_rows = 0;
+    uint64_t src, dst;
+
+    while (infile)
+    {
+        infile >> src >> dst;
+        max_id = std::max(max_id, src);
+        max_id = std::max(max_id, dst);
+
+        row_indices.push_back(src);
+        col_indices.push_back(dst);
+
+        ++num_rows;
+    }
+    std::cout << "Read " << num_rows << " rows." << std::endl;
+    std::cout << "#Nodes = " << (max_id + 1) << std::endl;
+
+    return (max_id + 1);
+}
+
+//****************************************************************************
+template <typename SemiringT, typename WVectorT, typename MatrixT,
+          typename UVectorT>
+double time_products(SemiringT                          op,
+                     WVectorT                          &w_mxv,
+                     WVectorT                          &w_vxm,
+                     MatrixT                     const &A,
+                     UVectorT                    const &u,
+                     unsigned int                       num_trials)
+{
+    Timer<std::chrono::steady_clock, std::chrono::microseconds> my_timer;
+
+    my_timer.start();
+    for (unsigned int trial = 0; trial < num_trials; ++trial)
+    {
+        mxv(w_mxv, NoMask(), NoAccumulate(), op, A, u);   // pull (dot)
+        vxm(w_vxm, NoMask(), NoAccumulate(), op, u, A);   // push (axpy)
+    }
+    my_timer.stop();
+
+    return my_timer.elapsed()/num_trials;
+}
+
+//****************************************************************************
+template <typename SemiringT, typename CMatrixT, typename MatrixT>
+double time_mxm(SemiringT            op,
+                CMatrixT            &C,
+                MatrixT       const &A,
+                unsigned int         num_trials)
+{
+    Timer<std::chrono::steady_clock, std::chrono::microseconds> my_timer;
+
+    my_timer.start();
+    for (unsigned int trial = 0; trial < num_trials; ++trial)
+    {
+        mxm(C, NoMask(), NoAccumulate(), op, A, A);
+    }
+    my_timer.stop();
+
+    return my_timer.elapsed()/num_trials;
+}
+
+//****************************************************************************
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "ERROR: too few arguments." << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <edge list file> [density]"
+                  << std::endl;
+        exit(1);
+    }
+
+    // Read the edgelist and create the tuple arrays
+    std::string pathname(argv[1]);
+    double density((argc > 2) ? atof(argv[2]) : 0.1);
+    IndexArrayType iA, jA;
+
+    IndexType const NUM_NODES(read_edge_list(pathname, iA, jA));
+    unsigned int const NUM_TRIALS(5);
+
+    std::vector<bool>   bv(iA.size(), true);
+    std::vector<double> dv(iA.size(), 1.0);
+    Matrix<bool>   A_bool(NUM_NODES, NUM_NODES);
+    Matrix<double> A_fp(NUM_NODES, NUM_NODES);
+    A_bool.build(iA.begin(), jA.begin(), bv.begin(), iA.size());
+    A_fp.build(iA.begin(), jA.begin(), dv.begin(), iA.size());
+
+    Vector<bool>   u_bool(NUM_NODES);
+    Vector<double> u_fp(NUM_NODES);
+
+    std::default_random_engine  generator;
+    std::uniform_real_distribution<double> distribution;
+    for (IndexType iu = 0; iu < NUM_NODES; ++iu)
+    {
+        if (distribution(generator) < density)
+        {
+            u_bool.setElement(iu, true);
+            u_fp.setElement(iu, distribution(generator));
+        }
+    }
+
+    std::cout << "u.nvals = " << u_fp.nvals() << ", trials = " << NUM_TRIALS
+              << std::endl;
+
+    //===================
+    // Boolean OR-AND
+    //===================
+    Vector<bool> w0(NUM_NODES), w1(NUM_NODES), w2(NUM_NODES), w3(NUM_NODES);
+    double generic_usec =
+        time_products(GenericOrAndSemiring<bool>(), w0, w1,
+                      A_bool, u_bool, NUM_TRIALS);
+    double special_usec =
+        time_products(LogicalSemiring<bool>(), w2, w3,
+                      A_bool, u_bool, NUM_TRIALS);
+
+    std::cout << "OR-AND     mxv+vxm generic    : " << generic_usec
+              << " usec" << std::endl;
+    std::cout << "OR-AND     mxv+vxm specialized: " << special_usec
+              << " usec, speedup = " << generic_usec/special_usec
+              << ((w0 == w2) && (w1 == w3) ? " (PASSED)" : " (FAILED)")
+              << std::endl;
+
+    //===================
+    // PLUS-TIMES double
+    //===================
+    Vector<double> x0(NUM_NODES), x1(NUM_NODES), x2(NUM_NODES), x3(NUM_NODES);
+    generic_usec =
+        time_products(GenericPlusTimesSemiring<double>(), x0, x1,
+                      A_fp, u_fp, NUM_TRIALS);
+    special_usec =
+        time_products(ArithmeticSemiring<double>(), x2, x3,
+                      A_fp, u_fp, NUM_TRIALS);
+
+    std::cout << "PLUS-TIMES mxv+vxm generic    : " << generic_usec
+              << " usec" << std::endl;
+    std::cout << "PLUS-TIMES mxv+vxm specialized: " << special_usec
+              << " usec, speedup = " << generic_usec/special_usec
+              << ((x0 == x2) && (x1 == x3) ? " (PASSED)" : " (FAILED)")
+              << std::endl;
+
+    //===================
+    // mxm (A*A) with both specializations
+    //===================
+    Matrix<bool> C0(NUM_NODES, NUM_NODES), C1(NUM_NODES, NUM_NODES);
+    generic_usec = time_mxm(GenericOrAndSemiring<bool>(), C0, A_bool, NUM_TRIALS);
+    special_usec = time_mxm(LogicalSemiring<bool>(), C1, A_bool, NUM_TRIALS);
+
+    std::cout << "OR-AND     mxm generic        : " << generic_usec
+              << " usec" << std::endl;
+    std::cout << "OR-AND     mxm specialized    : " << special_usec
+              << " usec, speedup = " << generic_usec/special_usec
+              << ((C0 == C1) ? " (PASSED)" : " (FAILED)") << std::endl;
+
+    Matrix<double> D0(NUM_NODES, NUM_NODES), D1(NUM_NODES, NUM_NODES);
+    generic_usec = time_mxm(GenericPlusTimesSemiring<double>(), D0, A_fp,
+                            NUM_TRIALS);
+    special_usec = time_mxm(ArithmeticSemiring<double>(), D1, A_fp, NUM_TRIALS);
+
+    std::cout << "PLUS-TIMES mxm generic        : " << generic_usec
+              << " usec" << std::endl;
+    std::cout << "PLUS-TIMES mxm specialized    : " << special_usec
+              << " usec, speedup = " << generic_usec/special_usec
+              << ((D0 == D1) ? " (PASSED)" : " (FAILED)") << std::endl;
+
+    return 0;
+}
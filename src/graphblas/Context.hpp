@@ -0,0 +1,234 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * DM20-0442
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+#include <graphblas/exceptions.hpp>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace grb
+{
+    //**************************************************************************
+    /// Preferred kernel for mxm.  This is a hint: a backend that does not
+    /// have the requested kernel for a given call uses its default one.
+    enum MxmKernelEnum
+    {
+        MXM_KERNEL_AUTO,  ///< Backend default
+        MXM_KERNEL_SPA,   ///< Row-wise (Gustavson), dense accumulator
+        MXM_KERNEL_PUSH,  ///< Row-wise (Gustavson), sorted merge accumulator
+        MXM_KERNEL_DOT    ///< Masked dot products (rows of A with columns of B)
+    };
+
+    //**************************************************************************
+    /**
+     * @brief Runtime settings used by the operations.
+     *
+     * One context is active at a time: it is installed with grb::init()
+     * (or for a single scope with ScopedContext) and read by the backend
+     * when an operation runs, so settings can be changed without
+     * recompiling.  Context::from_environment() reads:
+     *
+     *   GRB_NUM_THREADS      number of threads (0 or unset: OpenMP default)
+     *   GRB_SCRATCH_LIMIT    bytes a kernel scratch buffer may keep between
+     *                        operations (0 or unset: no limit)
+     *   GRB_MXM_KERNEL       auto, spa, push or dot
+     *   GRB_DENSE_THRESHOLD  fraction of a dense accumulator that must be
+     *                        touched before it is read back by a full scan
+     *                        rather than through its sorted touched list
+     */
+    struct Context
+    {
+        int           num_threads = 0;
+        std::size_t   scratch_limit = 0;
+        MxmKernelEnum mxm_kernel = MXM_KERNEL_AUTO;
+        double        dense_threshold = 0.1;
+
+        /// If set, called with the name and run time (in seconds) of every
+        /// operation
+        std::function<void(std::string const &, double)> perf_log;
+
+        static Context from_environment()
+        {
+            Context ctx;
+            if (char const *val = std::getenv("GRB_NUM_THREADS"))
+            {
+                ctx.num_threads = std::stoi(val);
+                if (ctx.num_threads < 0)
+                {
+                    throw InvalidValueException(
+                        "Context: GRB_NUM_THREADS must not be negative");
+                }
+            }
+            if (char const *val = std::getenv("GRB_SCRATCH_LIMIT"))
+            {
+                ctx.scratch_limit = std::stoull(val);
+            }
+            if (char const *val = std::getenv("GRB_MXM_KERNEL"))
+            {
+                std::string kernel(val);
+                if      (kernel == "auto") ctx.mxm_kernel = MXM_KERNEL_AUTO;
+                else if (kernel == "spa")  ctx.mxm_kernel = MXM_KERNEL_SPA;
+                else if (kernel == "push") ctx.mxm_kernel = MXM_KERNEL_PUSH;
+                else if (kernel == "dot")  ctx.mxm_kernel = MXM_KERNEL_DOT;
+                else
+                {
+                    throw InvalidValueException(
+                        "Context: unknown GRB_MXM_KERNEL '" + kernel + "'");
+                }
+            }
+            if (char const *val = std::getenv("GRB_DENSE_THRESHOLD"))
+            {
+                ctx.dense_threshold = std::stod(val);
+            }
+            return ctx;
+        }
+    };
+
+    namespace detail
+    {
+        inline Context &active_context()
+        {
+            static Context ctx;
+            return ctx;
+        }
+
+        /// Thread count to go back to when a context asks for the default
+        inline int default_num_threads()
+        {
+#if defined(_OPENMP)
+            static int const nthreads(omp_get_max_threads());
+            return nthreads;
+#else
+            return 1;
+#endif
+        }
+
+        /// Incremented at the start of every operation (see scratch_buffer)
+        inline std::atomic<uint64_t> &operation_epoch()
+        {
+            static std::atomic<uint64_t> epoch(0);
+            return epoch;
+        }
+
+        inline void install_context(Context const &ctx)
+        {
+#if defined(_OPENMP)
+            int default_threads(default_num_threads());
+            omp_set_num_threads((ctx.num_threads > 0) ? ctx.num_threads
+                                                      : default_threads);
+#endif
+            active_context() = ctx;
+        }
+
+        //**********************************************************************
+        /// Marks the start of an operation and, if the context has a
+        /// perf_log sink, reports the operation's run time when it goes out
+        /// of scope.
+        class OperationTimer
+        {
+        public:
+            explicit OperationTimer(char const *name)
+                : m_name(name),
+                  m_timed(static_cast<bool>(active_context().perf_log))
+            {
+                operation_epoch().fetch_add(1, std::memory_order_relaxed);
+                if (m_timed) m_start = std::chrono::steady_clock::now();
+            }
+
+            ~OperationTimer()
+            {
+                if (m_timed)
+                {
+                    std::chrono::duration<double> elapsed(
+                        std::chrono::steady_clock::now() - m_start);
+                    active_context().perf_log(m_name, elapsed.count());
+                }
+            }
+
+            OperationTimer(OperationTimer const &) = delete;
+            OperationTimer &operator=(OperationTimer const &) = delete;
+
+        private:
+            char const *m_name;
+            bool        m_timed;
+            std::chrono::steady_clock::time_point m_start;
+        };
+    }
+
+    //**************************************************************************
+    /// The active context
+    inline Context const &context()
+    {
+        return detail::active_context();
+    }
+
+    /// Install the given context
+    inline void init(Context const &ctx)
+    {
+        detail::install_context(ctx);
+    }
+
+    /// Install a context read from the environment
+    inline void init()
+    {
+        init(Context::from_environment());
+    }
+
+    //**************************************************************************
+    /// Installs a context for the lifetime of this object, then puts the
+    /// previous one back (for settings that only apply to some calls).
+    class ScopedContext
+    {
+    public:
+        explicit ScopedContext(Context const &ctx)
+            : m_saved(context())
+        {
+            detail::install_context(ctx);
+        }
+
+        ~ScopedContext()
+        {
+            detail::install_context(m_saved);
+        }
+
+        ScopedContext(ScopedContext const &) = delete;
+        ScopedContext &operator=(ScopedContext const &) = delete;
+
+    private:
+        Context m_saved;
+    };
+} // grb
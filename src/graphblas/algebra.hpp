@@ -32,8 +32,11 @@
 #include <algorithm>
 #include <functional>
 #include <limits>
+#include <type_traits>
 #include <utility>
 
+#include <graphblas/types.hpp>
+
 namespace grb
 {
     namespace detail
@@ -141,6 +144,158 @@ namespace grb
     //                               std::placeholders::_1),
     //
     //************************************************************************
+
+    //************************************************************************
+    // The Index-Unary Operators (predicates used by select)
+    //************************************************************************
+    // In lambda speak
+    // [](D1 val, IndexType i, IndexType j) -> bool { return j <= i; }
+    //
+    // For vectors j is always zero.  Operators that need a constant (the
+    // "thunk") take it in their constructor:
+    //
+    //                     grb::TriL(-1)                 // strictly lower
+    //                     grb::ValueLessEqual<float>(delta)
+    //
+    // Diagonal offsets are signed: k > 0 is above the main diagonal.
+
+    struct TriL
+    {
+        TriL(int64_t k = 0) : k(k) {}
+
+        template <typename D1>
+        inline bool operator()(D1, IndexType i, IndexType j) const
+        {
+            return static_cast<int64_t>(j) <= static_cast<int64_t>(i) + k;
+        }
+        int64_t k;
+    };
+
+    struct TriU
+    {
+        TriU(int64_t k = 0) : k(k) {}
+
+        template <typename D1>
+        inline bool operator()(D1, IndexType i, IndexType j) const
+        {
+            return static_cast<int64_t>(j) >= static_cast<int64_t>(i) + k;
+        }
+        int64_t k;
+    };
+
+    struct Diag
+    {
+        Diag(int64_t k = 0) : k(k) {}
+
+        template <typename D1>
+        inline bool operator()(D1, IndexType i, IndexType j) const
+        {
+            return static_cast<int64_t>(j) == static_cast<int64_t>(i) + k;
+        }
+        int64_t k;
+    };
+
+    struct OffDiag
+    {
+        OffDiag(int64_t k = 0) : k(k) {}
+
+        template <typename D1>
+        inline bool operator()(D1, IndexType i, IndexType j) const
+        {
+            return static_cast<int64_t>(j) != static_cast<int64_t>(i) + k;
+        }
+        int64_t k;
+    };
+
+    // Keeps rows (vector elements) in the half open range [first, last)
+    struct RowRange
+    {
+        RowRange(IndexType first, IndexType last) : first(first), last(last) {}
+
+        template <typename D1>
+        inline bool operator()(D1, IndexType i, IndexType) const
+        {
+            return (first <= i) && (i < last);
+        }
+        IndexType first, last;
+    };
+
+    //-------------------------------------------------------------------------
+    // Location valued operators (used by apply): the result is computed from
+    // the index of the stored value, plus the optional thunk.
+
+    template <typename D3 = IndexType>
+    struct RowIndex
+    {
+        RowIndex(int64_t s = 0) : s(s) {}
+
+        template <typename D1>
+        inline D3 operator()(D1, IndexType i, IndexType) const
+        {
+            return static_cast<D3>(static_cast<int64_t>(i) + s);
+        }
+        int64_t s;
+    };
+
+    template <typename D3 = IndexType>
+    struct ColIndex
+    {
+        ColIndex(int64_t s = 0) : s(s) {}
+
+        template <typename D1>
+        inline D3 operator()(D1, IndexType, IndexType j) const
+        {
+            return static_cast<D3>(static_cast<int64_t>(j) + s);
+        }
+        int64_t s;
+    };
+
+    // Signed distance from the main diagonal: j - i
+    template <typename D3 = int64_t>
+    struct DiagIndex
+    {
+        DiagIndex(int64_t s = 0) : s(s) {}
+
+        template <typename D1>
+        inline D3 operator()(D1, IndexType i, IndexType j) const
+        {
+            return static_cast<D3>(static_cast<int64_t>(j) -
+                                   static_cast<int64_t>(i) + s);
+        }
+        int64_t s;
+    };
+
+    //-------------------------------------------------------------------------
+    // Value thresholds: compare the stored value against the thunk
+#define GEN_GRAPHBLAS_VALUE_PREDICATE(P_NAME, COMPARE)                  \
+    template <typename D1>                                              \
+    struct P_NAME                                                       \
+    {                                                                   \
+        P_NAME(D1 thunk) : thunk(thunk) {}                              \
+                                                                        \
+        template <typename D2>                                          \
+        inline bool operator()(D2 val, IndexType, IndexType) const      \
+        {                                                               \
+            return static_cast<D1>(val) COMPARE thunk;                  \
+        }                                                               \
+        D1 thunk;                                                       \
+    };
+
+    GEN_GRAPHBLAS_VALUE_PREDICATE(ValueEqual,        ==)
+    GEN_GRAPHBLAS_VALUE_PREDICATE(ValueNotEqual,     !=)
+    GEN_GRAPHBLAS_VALUE_PREDICATE(ValueGreaterThan,  >)
+    GEN_GRAPHBLAS_VALUE_PREDICATE(ValueGreaterEqual, >=)
+    GEN_GRAPHBLAS_VALUE_PREDICATE(ValueLessThan,     <)
+    GEN_GRAPHBLAS_VALUE_PREDICATE(ValueLessEqual,    <=)
+
+    //-------------------------------------------------------------------------
+    // True for operators that take (value, i, j).  Anything that can also be
+    // called with the value alone (e.g., std::bind expressions, which discard
+    // extra arguments) is treated as a plain unary operator.
+    template <typename OpT, typename ScalarT>
+    inline constexpr bool is_index_unary_op_v =
+        std::is_invocable_v<OpT, ScalarT, IndexType, IndexType> &&
+        !std::is_invocable_v<OpT, ScalarT>;
 }
 
 namespace grb
@@ -284,6 +439,13 @@ namespace grb
         inline D3 operator()(D1 lhs, D2 rhs) const { return rhs; }
     };
 
+    // Structure only (aka ONEB): the result is one, operands are never read
+    template<typename D1, typename D2 = D1, typename D3 = D1>
+    struct Pair
+    {
+        inline D3 operator()(D1, D2) const { return static_cast<D3>(1); }
+    };
+
     //-------------------------------------------------------------------------
     /// @todo Consider decltype for D3's default
     template<typename D1, typename D2 = D1, typename D3 = D1>
@@ -376,6 +538,40 @@ namespace grb
         }                                                       \
     };
 
+//****************************************************************************
+/**
+ * The macro for building simple templated monoid classes that also have a
+ * terminal (absorbing) value: op(terminal, x) == terminal for all x.  Kernels
+ * may stop reducing as soon as the terminal value is reached.
+ *
+ * @param[in]  M_NAME     The class name
+ * @param[in]  BINARYOP   The binary op callable to turn into a monoid
+ * @param[in]  IDENTITY   The identity of the monoid
+ * @param[in]  TERMINAL   The terminal value of the monoid
+ */
+#define GEN_GRAPHBLAS_MONOID_TERMINAL(M_NAME, BINARYOP, IDENTITY, TERMINAL) \
+    template <typename ScalarT>                                 \
+    struct M_NAME                                               \
+    {                                                           \
+    public:                                                     \
+        using result_type = ScalarT;                            \
+                                                                \
+        ScalarT identity() const                                \
+        {                                                       \
+            return static_cast<ScalarT>(IDENTITY);              \
+        }                                                       \
+                                                                \
+        ScalarT terminal() const                                \
+        {                                                       \
+            return static_cast<ScalarT>(TERMINAL);              \
+        }                                                       \
+                                                                \
+        ScalarT operator()(ScalarT lhs, ScalarT rhs) const      \
+        {                                                       \
+            return BINARYOP<ScalarT>()(lhs, rhs);               \
+        }                                                       \
+    };
+
 //****************************************************************************
 namespace grb
 {
@@ -383,11 +579,31 @@ namespace grb
     GEN_GRAPHBLAS_MONOID(TimesMonoid, Times, 1)
 
     /// @todo the following identity only works for boolean domain
-    GEN_GRAPHBLAS_MONOID(LogicalOrMonoid,   LogicalOr,   false)
-    GEN_GRAPHBLAS_MONOID(LogicalAndMonoid,  LogicalAnd,  true)
+    GEN_GRAPHBLAS_MONOID_TERMINAL(LogicalOrMonoid,  LogicalOr,  false, true)
+    GEN_GRAPHBLAS_MONOID_TERMINAL(LogicalAndMonoid, LogicalAnd, true,  false)
     GEN_GRAPHBLAS_MONOID(LogicalXorMonoid,  LogicalXor,  false)
     GEN_GRAPHBLAS_MONOID(LogicalXnorMonoid, LogicalXnor, true)
 
+    // ***********************************************************************
+    // AnyMonoid may return either operand (this one returns the first), so
+    // every value is terminal: reductions can stop at the first value seen.
+    template <typename ScalarT>
+    struct AnyMonoid
+    {
+    public:
+        using result_type = ScalarT;
+
+        ScalarT identity() const
+        {
+            return static_cast<ScalarT>(0);
+        }
+
+        ScalarT operator()(ScalarT lhs, ScalarT) const
+        {
+            return lhs;
+        }
+    };
+
     // ***********************************************************************
     // MaxMonoid identity depends on the type requiring class templates and SFINAE
     // See below for explicit instantiations
@@ -407,6 +623,12 @@ namespace grb
             return static_cast<ScalarT>(std::numeric_limits<ScalarT>::min());
         }
 
+        // Only integers: with floating point a NaN could still change the result
+        ScalarT terminal() const
+        {
+            return static_cast<ScalarT>(std::numeric_limits<ScalarT>::max());
+        }
+
         ScalarT operator()(ScalarT lhs, ScalarT rhs) const
         {
             return grb::Max<ScalarT>()(lhs, rhs);
@@ -454,6 +676,12 @@ namespace grb
             return static_cast<ScalarT>(std::numeric_limits<ScalarT>::max());
         }
 
+        // Only integers: with floating point a NaN could still change the result
+        ScalarT terminal() const
+        {
+            return static_cast<ScalarT>(std::numeric_limits<ScalarT>::min());
+        }
+
         ScalarT operator()(ScalarT lhs, ScalarT rhs) const
         {
             return grb::Min<ScalarT>()(lhs, rhs);
@@ -500,6 +728,8 @@ namespace grb
         using first_argument_type = D1;                                 \
         using second_argument_type = D2;                                \
         using result_type = D3;                                         \
+        using add_monoid_type = ADD_MONOID<D3>;                         \
+        using mult_op_type = MULT_BINARYOP<D1, D2, D3>;                 \
                                                                         \
         D3 add(D3 a, D3 b) const                                        \
         { return ADD_MONOID<D3>()(a, b); }                              \
@@ -569,6 +799,123 @@ namespace grb
     GEN_GRAPHBLAS_SEMIRING(MaxFirstSemiring, MaxMonoid, First)
     GEN_GRAPHBLAS_SEMIRING(MaxSecondSemiring, MaxMonoid, Second)
 
+    //************************************************************************
+    // structure-only semirings: only the existence of a path matters
+    GEN_GRAPHBLAS_SEMIRING(AnyPairSemiring, AnyMonoid, Pair)
+    GEN_GRAPHBLAS_SEMIRING(AnyFirstSemiring, AnyMonoid, First)
+    GEN_GRAPHBLAS_SEMIRING(AnySecondSemiring, AnyMonoid, Second)
+    GEN_GRAPHBLAS_SEMIRING(PlusPairSemiring, PlusMonoid, Pair)
+
+} // namespace grb
+
+//****************************************************************************
+// Semiring traits
+//****************************************************************************
+
+namespace grb
+{
+    //************************************************************************
+    // Known semiring/type combinations for which the backends provide
+    // specialized kernels (selected at compile time with 'if constexpr').
+    // Anything else (including user-defined semirings) uses the generic path.
+
+    // Boolean OR-AND: results can be computed with bitwise word operations
+    template <class>
+    inline constexpr bool is_logical_bool_semiring_v = false;
+
+    template <>
+    inline constexpr bool is_logical_bool_semiring_v<
+        LogicalSemiring<bool, bool, bool>> = true;
+
+    // PLUS-TIMES on floating point: results can be computed with dense
+    // gather/scatter loops the compiler is able to vectorize.
+    template <class>
+    inline constexpr bool is_arithmetic_fp_semiring_v = false;
+
+    template <class ScalarT>
+    inline constexpr bool is_arithmetic_fp_semiring_v<
+        ArithmeticSemiring<ScalarT, ScalarT, ScalarT>> =
+        std::is_floating_point_v<ScalarT>;
+
+    // ANY-PAIR: only the structure of the result depends on the inputs
+    template <class>
+    inline constexpr bool is_any_monoid_v = false;
+
+    template <class ScalarT>
+    inline constexpr bool is_any_monoid_v<AnyMonoid<ScalarT>> = true;
+
+    template <class SemiringT, class = void>
+    inline constexpr bool is_any_semiring_v = false;
+
+    template <class SemiringT>
+    inline constexpr bool is_any_semiring_v<
+        SemiringT, std::void_t<typename SemiringT::add_monoid_type>> =
+        is_any_monoid_v<typename SemiringT::add_monoid_type>;
+
+    template <class SemiringT, class = void>
+    inline constexpr bool is_any_pair_semiring_v = false;
+
+    template <class SemiringT>
+    inline constexpr bool is_any_pair_semiring_v<
+        SemiringT, std::void_t<typename SemiringT::mult_op_type>> =
+        is_any_semiring_v<SemiringT> &&
+        std::is_same_v<typename SemiringT::mult_op_type,
+                       Pair<typename SemiringT::first_argument_type,
+                            typename SemiringT::second_argument_type,
+                            typename SemiringT::result_type>>;
+
+    //************************************************************************
+    // Terminal values: a monoid may declare terminal() (see
+    // GEN_GRAPHBLAS_MONOID_TERMINAL); a semiring inherits the terminal of its
+    // add_monoid_type.  Every value of AnyMonoid is terminal.  Kernels use
+    // is_terminal() to stop reducing early.
+    namespace detail
+    {
+        template <class OpT, class = void>
+        struct terminal_monoid { using type = OpT; };
+
+        template <class OpT>
+        struct terminal_monoid<OpT, std::void_t<typename OpT::add_monoid_type>>
+        {
+            using type = typename OpT::add_monoid_type;
+        };
+
+        template <class OpT>
+        using terminal_monoid_t = typename terminal_monoid<OpT>::type;
+
+        template <class OpT, class = void>
+        inline constexpr bool has_terminal_value_v = false;
+
+        template <class OpT>
+        inline constexpr bool has_terminal_value_v<
+            OpT,
+            std::void_t<decltype(
+                std::declval<terminal_monoid_t<OpT>>().terminal())>> = true;
+    }
+
+    template <class OpT>
+    inline constexpr bool has_terminal_v =
+        is_any_monoid_v<detail::terminal_monoid_t<OpT>> ||
+        detail::has_terminal_value_v<OpT>;
+
+    /// @return true if val is the terminal value of op's (add) monoid.
+    template <class OpT, class ScalarT>
+    inline bool is_terminal(OpT const &, ScalarT const &val)
+    {
+        if constexpr (is_any_monoid_v<detail::terminal_monoid_t<OpT>>)
+        {
+            return true;
+        }
+        else if constexpr (detail::has_terminal_value_v<OpT>)
+        {
+            return (val == detail::terminal_monoid_t<OpT>().terminal());
+        }
+        else
+        {
+            return false;
+        }
+    }
+
 } // namespace grb
 
 //****************************************************************************
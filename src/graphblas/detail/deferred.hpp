@@ -0,0 +1,423 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * DM20-0442
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <graphblas/types.hpp>
+
+namespace grb
+{
+    namespace detail
+    {
+        //**********************************************************************
+        // Non-blocking execution support.
+        //
+        // In non-blocking mode (see Context::mode) an operation is not run
+        // when it is called: it is appended to a per-thread queue together
+        // with the containers it reads and writes.  Queued operations run in
+        // submission order, and only as far as needed, when
+        //
+        //  - a container method that looks at the stored values (nvals,
+        //    extractElement, extractTuples, ==, ...) or that modifies them
+        //    directly (setElement, build, clear, ...) is called,
+        //  - an operation that returns a scalar (reduce to a scalar) is
+        //    called,
+        //  - a container with pending work is destroyed,
+        //  - grb::wait() is called or blocking mode is installed.
+        //
+        // While queued, an operation that completely overwrites its output
+        // (no mask, no accumulator) makes an earlier pending write of the
+        // same output dead if nothing in between reads it; dead writes are
+        // dropped without running.  Writes to a container that is destroyed
+        // are dropped too if nothing reads them.
+        //**********************************************************************
+
+        template <typename T, typename = void>
+        struct has_matrix_view_member : std::false_type {};
+
+        template <typename T>
+        struct has_matrix_view_member<T, std::void_t<decltype(std::declval<T>().m_mat)>>
+            : std::true_type {};
+
+        template <typename T, typename = void>
+        struct has_vector_view_member : std::false_type {};
+
+        template <typename T>
+        struct has_vector_view_member<T, std::void_t<decltype(std::declval<T>().m_vec)>>
+            : std::true_type {};
+
+        template <typename T, typename = void>
+        struct is_container : std::false_type {};
+
+        template <typename T>
+        struct is_container<T, std::void_t<decltype(std::declval<T>().nvals())>>
+            : std::bool_constant<!has_matrix_view_member<T>::value &&
+                                 !has_vector_view_member<T>::value> {};
+
+        /// The address of the container behind a matrix, vector or view of
+        /// one (nullptr for anything else: operators, indices, scalars).
+        template <typename T>
+        void const *container_key(T const &obj)
+        {
+            if constexpr (has_matrix_view_member<T>::value)
+                return container_key(obj.m_mat);
+            else if constexpr (has_vector_view_member<T>::value)
+                return container_key(obj.m_vec);
+            else if constexpr (is_container<T>::value)
+                return static_cast<void const *>(&obj);
+            else
+                return nullptr;
+        }
+
+        //**********************************************************************
+        /// A queued operation: what it writes, what it reads, how to run it.
+        class DeferredOp
+        {
+        public:
+            virtual ~DeferredOp() = default;
+            virtual void execute() = 0;
+
+            bool reads(void const *key) const
+            {
+                return std::find(m_inputs.begin(), m_inputs.end(), key) !=
+                    m_inputs.end();
+            }
+
+            bool touches(void const *key) const
+            {
+                return (m_output == key) || reads(key);
+            }
+
+            void const *output() const { return m_output; }
+
+        protected:
+            void set_keys(void const *output,
+                          std::vector<void const *> inputs)
+            {
+                m_output = output;
+                m_inputs = std::move(inputs);
+            }
+
+        private:
+            void const               *m_output = nullptr;
+            std::vector<void const *> m_inputs;
+        };
+
+        //**********************************************************************
+        /// Containers are held by reference, everything else (views,
+        /// operators, index arrays, scalars) by value.
+        template <typename T>
+        using held_type_t = std::conditional_t<
+            is_container<T>::value,
+            std::reference_wrapper<T const>,
+            T>;
+
+        template <typename T>
+        T const &unwrap(T const &arg) { return arg; }
+
+        template <typename T>
+        T &unwrap(std::reference_wrapper<T> const &arg) { return arg.get(); }
+
+        /// A backend call bound to its arguments.  The output container is
+        /// the first argument.
+        template <typename FnT, typename OutT, typename... ArgsT>
+        class DeferredCall : public DeferredOp
+        {
+        public:
+            DeferredCall(FnT fn, bool reads_output,
+                         OutT &out, ArgsT const &... args)
+                : m_fn(fn),
+                  m_out(out),
+                  m_args(held_type_t<ArgsT>(args)...)
+            {
+                std::vector<void const *> inputs;
+                for (void const *key : {container_key(args)...})
+                {
+                    if (key != nullptr) inputs.push_back(key);
+                }
+                if (reads_output) inputs.push_back(&out);
+                set_keys(&out, std::move(inputs));
+            }
+
+            void execute() override
+            {
+                std::apply([this](auto const &... args)
+                           { m_fn(m_out, unwrap(args)...); },
+                           m_args);
+            }
+
+        private:
+            FnT                                 m_fn;
+            OutT                               &m_out;
+            std::tuple<held_type_t<ArgsT>...>   m_args;
+        };
+
+        //**********************************************************************
+        /// Operations queued by this thread
+        class DeferredQueue
+        {
+        public:
+            bool empty() const { return m_ops.empty(); }
+            std::size_t size() const { return m_ops.size(); }
+
+            DeferredOp *back() { return m_ops.empty() ? nullptr : m_ops.back().get(); }
+
+            void push(std::unique_ptr<DeferredOp> op)
+            {
+                if (!op->reads(op->output()))
+                {
+                    drop_dead_writes(op->output(), m_ops.size());
+                }
+                m_ops.push_back(std::move(op));
+            }
+
+            /// Run everything up to the last operation that reads or writes
+            /// the given container.
+            void complete(void const *key)
+            {
+                if (key == nullptr) return;
+                for (std::size_t idx = m_ops.size(); idx > 0; --idx)
+                {
+                    if (m_ops[idx - 1]->touches(key))
+                    {
+                        run_prefix(idx);
+                        return;
+                    }
+                }
+            }
+
+            void complete_all() { run_prefix(m_ops.size()); }
+
+            /// The container is going away: drop writes to it that nothing
+            /// reads, then run whatever still uses it.
+            void release(void const *key)
+            {
+                drop_dead_writes(key, m_ops.size());
+                complete(key);
+            }
+
+        private:
+            /// Remove writers of key in [0, end) that are not followed by a
+            /// reader of key before end.
+            void drop_dead_writes(void const *key, std::size_t end)
+            {
+                for (std::size_t idx = end; idx > 0; --idx)
+                {
+                    DeferredOp const &op(*m_ops[idx - 1]);
+                    if (op.reads(key)) return;
+                    if (op.output() == key)
+                    {
+                        m_ops.erase(m_ops.begin() + (idx - 1));
+                    }
+                }
+            }
+
+            void run_prefix(std::size_t count)
+            {
+                if (m_running || (count == 0)) return;
+                m_running = true;
+
+                // Detach the prefix first so that a throwing operation does
+                // not leave it (or the ones already run) in the queue.
+                std::vector<std::unique_ptr<DeferredOp>> ops(
+                    std::make_move_iterator(m_ops.begin()),
+                    std::make_move_iterator(m_ops.begin() + count));
+                m_ops.erase(m_ops.begin(), m_ops.begin() + count);
+                try
+                {
+                    for (auto &op : ops) op->execute();
+                }
+                catch (...)
+                {
+                    m_running = false;
+                    throw;
+                }
+                m_running = false;
+            }
+
+            std::vector<std::unique_ptr<DeferredOp>> m_ops;
+            bool m_running = false;
+        };
+
+        inline DeferredQueue &deferred_queue()
+        {
+            static thread_local DeferredQueue queue;
+            return queue;
+        }
+
+        /// Set by install_context(): whether new operations are queued
+        inline std::atomic<bool> &nonblocking_flag()
+        {
+            static std::atomic<bool> flag(false);
+            return flag;
+        }
+
+        inline bool nonblocking()
+        {
+            return nonblocking_flag().load(std::memory_order_relaxed);
+        }
+
+        inline void set_nonblocking(bool flag)
+        {
+            nonblocking_flag().store(flag, std::memory_order_relaxed);
+            if (!flag) deferred_queue().complete_all();
+        }
+
+        /// Run the pending operations needed to observe the given containers
+        /// (or views of them)
+        template <typename... ObjsT>
+        void complete(ObjsT const &... objs)
+        {
+            DeferredQueue &queue(deferred_queue());
+            if (queue.empty()) return;
+            (queue.complete(container_key(objs)), ...);
+        }
+
+        /// Called by a container's destructor
+        inline void release(void const *key)
+        {
+            DeferredQueue &queue(deferred_queue());
+            if (!queue.empty()) queue.release(key);
+        }
+
+        //**********************************************************************
+        /// Run a backend call now (blocking mode) or queue it.  reads_output
+        /// is false only when the call replaces all of the output's contents.
+        template <typename FnT, typename OutT, typename... ArgsT>
+        void submit(FnT fn, bool reads_output, OutT &out, ArgsT const &... args)
+        {
+            if (!nonblocking())
+            {
+                fn(out, args...);
+                return;
+            }
+            deferred_queue().push(std::make_unique<DeferredCall<FnT, OutT, ArgsT...>>(
+                           fn, reads_output, out, args...));
+        }
+
+        //**********************************************************************
+        /// An unmasked, unaccumulated apply followed by any number of in-place
+        /// unary applies to its output, run as one pass: the stages are
+        /// composed into the operator of the first apply.  Each stage sees
+        /// the value converted to the output's scalar type, as it would if
+        /// the applies ran one after the other.
+        template <typename OutT>
+        class UnaryApplyChain : public DeferredOp
+        {
+        public:
+            using ScalarType = typename OutT::ScalarType;
+            using StageType = std::function<ScalarType(ScalarType const &)>;
+
+            template <typename FnT, typename UnaryOpT, typename InT>
+            UnaryApplyChain(FnT fn, OutT &out, UnaryOpT op, InT const &in)
+            {
+                held_type_t<InT> held_in(in);
+                m_run = [fn, &out, op, held_in](std::vector<StageType> const &stages)
+                {
+                    if (stages.empty())
+                    {
+                        fn(out, op, unwrap(held_in));
+                        return;
+                    }
+                    fn(out,
+                       [&op, &stages](auto const &val)
+                       {
+                           ScalarType result(op(val));
+                           for (auto const &stage : stages)
+                           {
+                               result = stage(result);
+                           }
+                           return result;
+                       },
+                       unwrap(held_in));
+                };
+
+                std::vector<void const *> inputs;
+                if (void const *key = container_key(in)) inputs.push_back(key);
+                set_keys(&out, std::move(inputs));
+            }
+
+            template <typename UnaryOpT>
+            void append(UnaryOpT op)
+            {
+                m_stages.emplace_back([op](ScalarType const &val)
+                                      { return static_cast<ScalarType>(op(val)); });
+            }
+
+            void execute() override { m_run(m_stages); }
+
+        private:
+            std::function<void(std::vector<StageType> const &)> m_run;
+            std::vector<StageType> m_stages;
+        };
+
+        /// Run or queue out := op(in) (no mask, no accumulator).  If out is
+        /// also the input and the last queued operation is an apply chain
+        /// writing out, op becomes one more stage of that chain.  fn(out,
+        /// op, in) makes the backend call.
+        template <typename FnT, typename OutT, typename UnaryOpT, typename InT>
+        void submit_unary_apply(FnT fn, OutT &out, UnaryOpT op, InT const &in)
+        {
+            if (!nonblocking())
+            {
+                fn(out, op, in);
+                return;
+            }
+
+            DeferredQueue &queue(deferred_queue());
+            if constexpr (std::is_same_v<InT, OutT>)
+            {
+                auto *chain(dynamic_cast<UnaryApplyChain<OutT> *>(queue.back()));
+                if ((&in == &out) && (chain != nullptr) &&
+                    (chain->output() == &out))
+                {
+                    chain->append(op);
+                    return;
+                }
+            }
+            queue.push(std::make_unique<UnaryApplyChain<OutT>>(fn, out, op, in));
+        }
+
+        /// Whether an operation with this mask and accumulator type reads
+        /// the previous contents of its output
+        template <typename MaskT, typename AccumT>
+        constexpr bool keeps_output()
+        {
+            return !(std::is_same_v<MaskT, NoMask> &&
+                     std::is_same_v<AccumT, NoAccumulate>);
+        }
+    }
+}
@@ -46,6 +46,7 @@ namespace grb
 
 #include <graphblas/types.hpp>
 #include <graphblas/exceptions.hpp>
+#include <graphblas/Context.hpp>
 
 #include <graphblas/algebra.hpp>
 
@@ -97,34 +97,8 @@ namespace grb
     {
         /// @todo assert A, L, and U are same size.
 
-        using T = typename MatrixT::ScalarType;
-
-        grb::IndexType nvals(A.nvals());
-
-        grb::IndexArrayType i(nvals), j(nvals);
-        std::vector<T> v(nvals);
-        A.extractTuples(i, j, v);
-
-        IndexArrayType iL,jL, iU,jU;
-        std::vector<T> vL, vU;
-
-        for (grb::IndexType idx = 0; idx < nvals; ++idx)
-        {
-            if (i[idx] < j[idx])
-            {
-                iU.push_back(i[idx]);
-                jU.push_back(j[idx]);
-                vU.push_back(v[idx]);
-            }
-            else
-            {
-                iL.push_back(i[idx]);
-                jL.push_back(j[idx]);
-                vL.push_back(v[idx]);
-            }
-        }
-        L.build(iL.begin(), jL.begin(), vL.begin(), vL.size());
-        U.build(iU.begin(), jU.begin(), vU.begin(), vU.size());
+        grb::select(L, grb::NoMask(), grb::NoAccumulate(), grb::TriL(0), A);
+        grb::select(U, grb::NoMask(), grb::NoAccumulate(), grb::TriU(1), A);
     }
 
     //************************************************************************
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include <graphblas/types.hpp>
+#include <graphblas/Context.hpp>
 #include <graphblas/algebra.hpp>
 #include <graphblas/TransposeView.hpp>
 #include <graphblas/StructureView.hpp>
@@ -76,6 +77,7 @@ namespace grb
                     OutputControlEnum outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("mxm - 4.3.1 - matrix-matrix multiply");
+        detail::OperationTimer const op_timer("mxm - 4.3.1 - matrix-matrix multiply");
         GRB_LOG_VERBOSE("C in :" << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask in : " << get_internal_matrix(Mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -103,6 +105,48 @@ namespace grb
 
     //************************************************************************
 
+    // Extension: fused matrix-matrix multiply and reduce to scalar
+    //   val = reduce(monoid, (A +.* B)<Mask>)
+    // Equivalent to an mxm into a temporary followed by a matrix-to-scalar
+    // reduce, but the product is never stored.
+    template<typename ValueT,
+             typename MaskT,
+             typename MonoidT,
+             typename SemiringT,
+             typename AMatrixT,
+             typename BMatrixT>
+    inline void mxm_reduce(ValueT           &val,
+                           MaskT      const &Mask,
+                           MonoidT           monoid,
+                           SemiringT         op,
+                           AMatrixT   const &A,
+                           BMatrixT   const &B)
+    {
+        GRB_LOG_FN_BEGIN("mxm_reduce - fused matrix-matrix multiply and reduce");
+        detail::OperationTimer const op_timer("mxm_reduce - fused matrix-matrix multiply and reduce");
+        GRB_LOG_VERBOSE("val in: " << val);
+        GRB_LOG_VERBOSE("Mask in : " << get_internal_matrix(Mask));
+        GRB_LOG_VERBOSE_OP(monoid);
+        GRB_LOG_VERBOSE_OP(op);
+        GRB_LOG_VERBOSE("A in :" << get_internal_matrix(A));
+        GRB_LOG_VERBOSE("B in :" << get_internal_matrix(B));
+
+        check_nrows_nrows(A, Mask, "mxm_reduce: A.nrows != Mask.nrows");
+        check_ncols_ncols(B, Mask, "mxm_reduce: B.ncols != Mask.ncols");
+        check_ncols_nrows(A, B, "mxm_reduce: A.ncols != B.nrows");
+
+        backend::mxm_reduce(val,
+                            get_internal_matrix(Mask),
+                            monoid, op,
+                            get_internal_matrix(A),
+                            get_internal_matrix(B));
+
+        GRB_LOG_VERBOSE("val out: " << val);
+        GRB_LOG_FN_END("mxm_reduce - fused matrix-matrix multiply and reduce");
+    }
+
+    //************************************************************************
+
     // 4.3.2: Vector-matrix multiply
     template<typename WVectorT,
              typename MaskT,
@@ -119,6 +163,7 @@ namespace grb
                     OutputControlEnum outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("mxv - 4.3.2 - vector-matrix multiply");
+        detail::OperationTimer const op_timer("mxv - 4.3.2 - vector-matrix multiply");
         GRB_LOG_VERBOSE("w in :" << get_internal_vector(w));
         GRB_LOG_VERBOSE("mask in : " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -155,6 +200,7 @@ namespace grb
                     OutputControlEnum  outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("mxv - 4.3.3 - matrix-vector multiply");
+        detail::OperationTimer const op_timer("mxv - 4.3.3 - matrix-vector multiply");
         GRB_LOG_VERBOSE("w in :" << get_internal_vector(w));
         GRB_LOG_VERBOSE("Mask in : " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -198,6 +244,7 @@ namespace grb
                           OutputControlEnum            outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("eWiseMult - 4.3.4.1 - element-wise vector multiply");
+        detail::OperationTimer const op_timer("eWiseMult - 4.3.4.1 - element-wise vector multiply");
         GRB_LOG_VERBOSE("w in :" << get_internal_vector(w));
         GRB_LOG_VERBOSE("Mask in : " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -235,6 +282,7 @@ namespace grb
                           OutputControlEnum            outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("eWiseMult - 4.3.4.2 - element-wise matrix multiply");
+        detail::OperationTimer const op_timer("eWiseMult - 4.3.4.2 - element-wise matrix multiply");
         GRB_LOG_VERBOSE("C in :" << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask in : " << get_internal_matrix(Mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -284,6 +332,7 @@ namespace grb
                          OutputControlEnum            outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("eWiseAdd - 4.3.5.1 - element-wise vector addition");
+        detail::OperationTimer const op_timer("eWiseAdd - 4.3.5.1 - element-wise vector addition");
         GRB_LOG_VERBOSE("w in :" << get_internal_vector(w));
         GRB_LOG_VERBOSE("Mask in : " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -324,6 +373,7 @@ namespace grb
                          OutputControlEnum            outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("eWiseAdd - 4.3.5.2 - element-wise matrix addition");
+        detail::OperationTimer const op_timer("eWiseAdd - 4.3.5.2 - element-wise matrix addition");
         GRB_LOG_VERBOSE("C in :" << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask in : " << get_internal_matrix(Mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -368,6 +418,7 @@ namespace grb
                         OutputControlEnum     outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("extract - 4.3.6.1 - standard vector variant");
+        detail::OperationTimer const op_timer("extract - 4.3.6.1 - standard vector variant");
 
         GRB_LOG_VERBOSE("w:    " << get_internal_vector(w));
         GRB_LOG_VERBOSE("mask: " << get_internal_vector(mask));
@@ -406,6 +457,7 @@ namespace grb
                         OutputControlEnum        outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("extract - 4.3.6.2 - standard matrix variant");
+        detail::OperationTimer const op_timer("extract - 4.3.6.2 - standard matrix variant");
 
         GRB_LOG_VERBOSE("C: " << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask: " << get_internal_matrix(Mask));
@@ -448,6 +500,7 @@ namespace grb
                         OutputControlEnum           outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("extract - 4.3.6.3 - column (and row) variant");
+        detail::OperationTimer const op_timer("extract - 4.3.6.3 - column (and row) variant");
 
         GRB_LOG_VERBOSE("w:    " << get_internal_vector(w));
         GRB_LOG_VERBOSE("mask: " << get_internal_vector(mask));
@@ -492,6 +545,7 @@ namespace grb
                        OutputControlEnum                outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("assign - 4.3.7.1 - standard vector variant");
+        detail::OperationTimer const op_timer("assign - 4.3.7.1 - standard vector variant");
         GRB_LOG_VERBOSE("w in: " << get_internal_vector(w));
         GRB_LOG_VERBOSE("mask in: " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -530,6 +584,7 @@ namespace grb
                        OutputControlEnum      outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("assign - 4.3.7.2 - standard matrix variant");
+        detail::OperationTimer const op_timer("assign - 4.3.7.2 - standard matrix variant");
 
         GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask in: " << get_internal_matrix(Mask));
@@ -572,6 +627,7 @@ namespace grb
                        OutputControlEnum            outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("assign - 4.3.7.3 - column variant");
+        detail::OperationTimer const op_timer("assign - 4.3.7.3 - column variant");
 
         GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
         GRB_LOG_VERBOSE("mask in: " << get_internal_vector(mask));
@@ -613,6 +669,7 @@ namespace grb
                        OutputControlEnum            outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("assign - 4.3.7.4 - row variant");
+        detail::OperationTimer const op_timer("assign - 4.3.7.4 - row variant");
         GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
         GRB_LOG_VERBOSE("mask in: " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -655,6 +712,7 @@ namespace grb
                        OutputControlEnum             outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("assign - 4.3.7.5 - constant vector variant");
+        detail::OperationTimer const op_timer("assign - 4.3.7.5 - constant vector variant");
         GRB_LOG_VERBOSE("w in: " << get_internal_vector(w));
         GRB_LOG_VERBOSE("Mask in: " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -695,6 +753,7 @@ namespace grb
                        OutputControlEnum     outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("assign - 4.3.7.6 - constant matrix variant");
+        detail::OperationTimer const op_timer("assign - 4.3.7.6 - constant matrix variant");
         GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask in: " << get_internal_matrix(Mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -727,6 +786,7 @@ namespace grb
     //************************************************************************
 
     // 4.3.8.1: vector variant
+    // op may also be index-unary, op(u(i), i, 0), e.g., grb::RowIndex
     template<typename WScalarT,
              typename MaskT,
              typename AccumT,
@@ -741,6 +801,7 @@ namespace grb
                       OutputControlEnum            outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("apply - 4.3.8.1 - vector variant");
+        detail::OperationTimer const op_timer("apply - 4.3.8.1 - vector variant");
         GRB_LOG_VERBOSE("w in: " << get_internal_vector(w));
         GRB_LOG_VERBOSE("mask in: " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -751,17 +812,31 @@ namespace grb
         check_size_size(w, mask, "apply(vec): w.size != mask.size");
         check_size_size(w, u, "apply(vec): w.size != u.size");
 
-        backend::apply(get_internal_vector(w),
-                       get_internal_vector(mask),
-                       accum, op,
-                       get_internal_vector(u),
-                       outp);
+        // Index-unary operators (e.g., RowIndex) also see the location
+        if constexpr (is_index_unary_op_v<UnaryOpT,
+                                          typename UVectorT::ScalarType>)
+        {
+            backend::apply_index(get_internal_vector(w),
+                                 get_internal_vector(mask),
+                                 accum, op,
+                                 get_internal_vector(u),
+                                 outp);
+        }
+        else
+        {
+            backend::apply(get_internal_vector(w),
+                           get_internal_vector(mask),
+                           accum, op,
+                           get_internal_vector(u),
+                           outp);
+        }
 
         GRB_LOG_VERBOSE("w out: " << get_internal_vector(w));
         GRB_LOG_FN_END("apply - 4.3.8.1 - vector variant");
     }
 
     // 4.3.8.2: matrix variant
+    // op may also be index-unary, op(A(i,j), i, j), e.g., grb::ColIndex
     template<typename CScalarT,
              typename MaskT,
              typename AccumT,
@@ -777,6 +852,7 @@ namespace grb
     {
 
         GRB_LOG_FN_BEGIN("apply - 4.3.8.2 - matrix variant");
+        detail::OperationTimer const op_timer("apply - 4.3.8.2 - matrix variant");
         GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask in: " << get_internal_matrix(Mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -789,11 +865,24 @@ namespace grb
         check_ncols_ncols(C, A, "apply(mat): C.ncols != A.ncols");
         check_nrows_nrows(C, A, "apply(mat): C.nrows != A.nrows");
 
-        backend::apply(get_internal_matrix(C),
-                       get_internal_matrix(Mask),
-                       accum, op,
-                       get_internal_matrix(A),
-                       outp);
+        // Index-unary operators (e.g., RowIndex) also see the location
+        if constexpr (is_index_unary_op_v<UnaryOpT,
+                                          typename AMatrixT::ScalarType>)
+        {
+            backend::apply_index(get_internal_matrix(C),
+                                 get_internal_matrix(Mask),
+                                 accum, op,
+                                 get_internal_matrix(A),
+                                 outp);
+        }
+        else
+        {
+            backend::apply(get_internal_matrix(C),
+                           get_internal_matrix(Mask),
+                           accum, op,
+                           get_internal_matrix(A),
+                           outp);
+        }
 
         GRB_LOG_VERBOSE("C out: " << get_internal_matrix(C));
         GRB_LOG_FN_END("apply - 4.3.8.2 - matrix variant");
@@ -825,6 +914,7 @@ namespace grb
 
         if constexpr(is_bind1st) {
             GRB_LOG_FN_BEGIN("apply - 4.3.8.3 - vector binaryop bind1st variant");
+            detail::OperationTimer const op_timer("apply - 4.3.8.3 - vector binaryop bind1st variant");
             GRB_LOG_VERBOSE("w in: " << get_internal_vector(w));
             GRB_LOG_VERBOSE("mask in: " << get_internal_vector(mask));
             GRB_LOG_VERBOSE_ACCUM(accum);
@@ -848,6 +938,7 @@ namespace grb
         }
         else {
             GRB_LOG_FN_BEGIN("apply - 4.3.8.3 - vector binaryop bind2nd variant");
+            detail::OperationTimer const op_timer("apply - 4.3.8.3 - vector binaryop bind2nd variant");
             GRB_LOG_VERBOSE("w in: " << get_internal_vector(w));
             GRB_LOG_VERBOSE("mask in: " << get_internal_vector(mask));
             GRB_LOG_VERBOSE_ACCUM(accum);
@@ -897,6 +988,7 @@ namespace grb
 
         if constexpr(is_bind1st) {
             GRB_LOG_FN_BEGIN("apply - 4.3.8.4 - matrix binaryop bind1st variant");
+            detail::OperationTimer const op_timer("apply - 4.3.8.4 - matrix binaryop bind1st variant");
             GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
             GRB_LOG_VERBOSE("Mask in: " << get_internal_matrix(Mask));
             GRB_LOG_VERBOSE_ACCUM(accum);
@@ -923,6 +1015,7 @@ namespace grb
         else
         {
             GRB_LOG_FN_BEGIN("apply - 4.3.8.4 - matrix binaryop bind2nd variant");
+            detail::OperationTimer const op_timer("apply - 4.3.8.4 - matrix binaryop bind2nd variant");
             GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
             GRB_LOG_VERBOSE("Mask in: " << get_internal_matrix(Mask));
             GRB_LOG_VERBOSE_ACCUM(accum);
@@ -948,6 +1041,88 @@ namespace grb
         }
     }
 
+    //************************************************************************
+    // select
+    //************************************************************************
+
+    // select - vector variant: w<mask,z> := u(op(u(i), i, 0))
+    // Keeps the stored elements of u for which the index-unary predicate
+    // (e.g., grb::RowRange, grb::ValueGreaterThan) returns true.
+    template<typename WScalarT,
+             typename MaskT,
+             typename AccumT,
+             typename IndexUnaryOpT,
+             typename UVectorT,
+             typename ...WTagsT>
+    inline void select(Vector<WScalarT, WTagsT...> &w,
+                       MaskT                 const &mask,
+                       AccumT                const &accum,
+                       IndexUnaryOpT                op,
+                       UVectorT              const &u,
+                       OutputControlEnum            outp = MERGE)
+    {
+        GRB_LOG_FN_BEGIN("select - vector variant");
+        detail::OperationTimer const op_timer("select - vector variant");
+        GRB_LOG_VERBOSE("w in: " << get_internal_vector(w));
+        GRB_LOG_VERBOSE("mask in: " << get_internal_vector(mask));
+        GRB_LOG_VERBOSE_ACCUM(accum);
+        GRB_LOG_VERBOSE_OP(op);
+        GRB_LOG_VERBOSE("u in: " << get_internal_vector(u));
+        GRB_LOG_VERBOSE_OUTP(outp);
+
+        check_size_size(w, mask, "select(vec): w.size != mask.size");
+        check_size_size(w, u, "select(vec): w.size != u.size");
+
+        backend::select(get_internal_vector(w),
+                        get_internal_vector(mask),
+                        accum, op,
+                        get_internal_vector(u),
+                        outp);
+
+        GRB_LOG_VERBOSE("w out: " << get_internal_vector(w));
+        GRB_LOG_FN_END("select - vector variant");
+    }
+
+    // select - matrix variant: C<Mask,z> := A(op(A(i,j), i, j))
+    // Keeps the stored elements of A for which the index-unary predicate
+    // (e.g., grb::TriL, grb::Diag, grb::ValueLessEqual) returns true.
+    template<typename CScalarT,
+             typename MaskT,
+             typename AccumT,
+             typename IndexUnaryOpT,
+             typename AMatrixT,
+             typename ...CTagsT>
+    inline void select(Matrix<CScalarT, CTagsT...> &C,
+                       MaskT                 const &Mask,
+                       AccumT                const &accum,
+                       IndexUnaryOpT                op,
+                       AMatrixT              const &A,
+                       OutputControlEnum            outp = MERGE)
+    {
+        GRB_LOG_FN_BEGIN("select - matrix variant");
+        detail::OperationTimer const op_timer("select - matrix variant");
+        GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
+        GRB_LOG_VERBOSE("Mask in: " << get_internal_matrix(Mask));
+        GRB_LOG_VERBOSE_ACCUM(accum);
+        GRB_LOG_VERBOSE_OP(op);
+        GRB_LOG_VERBOSE("A in: " << get_internal_matrix(A));
+        GRB_LOG_VERBOSE_OUTP(outp);
+
+        check_ncols_ncols(C, Mask, "select(mat): C.ncols != Mask.ncols");
+        check_nrows_nrows(C, Mask, "select(mat): C.nrows != Mask.nrows");
+        check_ncols_ncols(C, A, "select(mat): C.ncols != A.ncols");
+        check_nrows_nrows(C, A, "select(mat): C.nrows != A.nrows");
+
+        backend::select(get_internal_matrix(C),
+                        get_internal_matrix(Mask),
+                        accum, op,
+                        get_internal_matrix(A),
+                        outp);
+
+        GRB_LOG_VERBOSE("C out: " << get_internal_matrix(C));
+        GRB_LOG_FN_END("select - matrix variant");
+    }
+
     //************************************************************************
     // reduce
     //************************************************************************
@@ -967,6 +1142,7 @@ namespace grb
                        OutputControlEnum  outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("reduce - 4.3.9.1 - matrix to vector variant");
+        detail::OperationTimer const op_timer("reduce - 4.3.9.1 - matrix to vector variant");
         GRB_LOG_VERBOSE("w in: " << get_internal_vector(w));
         GRB_LOG_VERBOSE("mask in: " << get_internal_vector(mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -1000,6 +1176,7 @@ namespace grb
             Vector<UScalarT, UTagsT...> const &u)
     {
         GRB_LOG_FN_BEGIN("reduce - 4.3.9.2 - vector to scalar variant");
+        detail::OperationTimer const op_timer("reduce - 4.3.9.2 - vector to scalar variant");
         GRB_LOG_VERBOSE("val in: " << val);
         GRB_LOG_VERBOSE_ACCUM(accum);
         GRB_LOG_VERBOSE_OP(op);
@@ -1028,6 +1205,7 @@ namespace grb
             Matrix<AScalarT, ATagsT...> const &A)
     {
         GRB_LOG_FN_BEGIN("reduce - 4.3.9.3 - matrix to scalar variant");
+        detail::OperationTimer const op_timer("reduce - 4.3.9.3 - matrix to scalar variant");
         GRB_LOG_VERBOSE("val in: " << val);
         GRB_LOG_VERBOSE_ACCUM(accum);
         GRB_LOG_VERBOSE_OP(op);
@@ -1057,6 +1235,7 @@ namespace grb
                           OutputControlEnum  outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("transpose - 4.3.10");
+        detail::OperationTimer const op_timer("transpose - 4.3.10");
         GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask in: " << get_internal_matrix(Mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -1094,6 +1273,7 @@ namespace grb
                           OutputControlEnum  outp = MERGE)
     {
         GRB_LOG_FN_BEGIN("kronecker - 4.3.11");
+        detail::OperationTimer const op_timer("kronecker - 4.3.11");
         GRB_LOG_VERBOSE("C in: " << get_internal_matrix(C));
         GRB_LOG_VERBOSE("Mask in: " << get_internal_matrix(Mask));
         GRB_LOG_VERBOSE_ACCUM(accum);
@@ -1121,10 +1301,8 @@ namespace grb
     }
 
     //************************************************************************
-    // Context etc.
+    // Context etc. (see Context.hpp for init)
     //************************************************************************
-    void init() {}
-
     template <typename T>
     void wait(T&& obj) {}
 
@@ -442,7 +442,8 @@ namespace grb
             //     return m_data[row_index];
             // }
 
-            // Allow casting
+            // Allow casting.  setRow and mergeRow may be called concurrently
+            // from different threads as long as the rows are distinct.
             template <typename OtherScalarT>
             void setRow(
                 IndexType row_index,
@@ -451,7 +452,7 @@ namespace grb
                 IndexType old_nvals = m_data[row_index].size();
                 IndexType new_nvals = row_data.size();
 
-                m_nvals = m_nvals + new_nvals - old_nvals;
+                adjustNvals(new_nvals - old_nvals);
                 //m_data[row_index] = row_data;   // swap here?
                 m_data[row_index].clear();
                 for (auto&& [idx, val] : row_data)
@@ -468,7 +469,7 @@ namespace grb
                 IndexType old_nvals = m_data[row_index].size();
                 IndexType new_nvals = row_data.size();
 
-                m_nvals = m_nvals + new_nvals - old_nvals;
+                adjustNvals(new_nvals - old_nvals);
                 m_data[row_index].swap(row_data); // = row_data;
             }
 
@@ -799,6 +800,13 @@ namespace grb
             IndexType m_num_cols;
             IndexType m_nvals;
 
+            // Unsigned wrap-around makes a "negative" delta subtract.
+            void adjustNvals(IndexType delta)
+            {
+#pragma omp atomic
+                m_nvals += delta;
+            }
+
             // List-of-lists storage (LIL) really VOV
             std::vector<RowType> m_data;
         };
@@ -75,22 +75,16 @@ namespace grb
 
             if ((u.nvals() > 0) && (v.nvals() > 0))
             {
-                ewise_and(t_contents, u.getContents(), v.getContents(), op);
+                // With a mask, only compute the entries it allows
+                if constexpr (std::is_same_v<MaskT, NoMask>)
+                    ewise_and(t_contents, u.getContents(), v.getContents(), op);
+                else
+                    masked_ewise_and_1D(t_contents, u, v, mask, op);
             }
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                D3ScalarType,
-                decltype(accum(std::declval<WScalarT>(),
-                               std::declval<D3ScalarType>()))>;
-            std::vector<std::tuple<IndexType,ZScalarType> > z_contents;
-            ewise_or_opt_accum_1D(z_contents, w, t_contents, accum);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask_1D(w, z_contents, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t_contents, mask, accum, outp);
         }
 
         //**********************************************************************
@@ -128,11 +122,20 @@ namespace grb
             {
                 // create one row of result at a time
                 TRowType T_row;
+#pragma omp parallel for schedule(dynamic, 64) private(T_row)
                 for (IndexType row_idx = 0; row_idx < num_rows; ++row_idx)
                 {
                     if (!B[row_idx].empty() && !A[row_idx].empty())
                     {
-                        ewise_and(T_row, A[row_idx], B[row_idx], op);
+                        // With a mask, only compute the entries it allows
+                        if constexpr (std::is_same_v<MaskT, NoMask>)
+                            ewise_and(T_row, A[row_idx], B[row_idx], op);
+                        else
+                            masked_ewise_and(
+                                T_row, A[row_idx], B[row_idx],
+                                get_mask_matrix(Mask)[row_idx],
+                                mask_structure_flag_v<MaskT>,
+                                mask_complement_flag_v<MaskT>, op);
 
                         if (!T_row.empty())
                         {
@@ -144,18 +147,8 @@ namespace grb
             }
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                D3ScalarType,
-                decltype(accum(std::declval<CScalarT>(),
-                               std::declval<D3ScalarType>()))>;
-            LilSparseMatrix<ZScalarType> Z(num_rows, num_cols);
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
 
         } // ewisemult
 
@@ -267,18 +260,8 @@ namespace grb
             }
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                D3ScalarType,
-                decltype(accum(std::declval<CScalarT>(),
-                               std::declval<D3ScalarType>()))>;
-            LilSparseMatrix<ZScalarType> Z(num_cols, num_rows);
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
         } // ewisemult
 
     } // backend
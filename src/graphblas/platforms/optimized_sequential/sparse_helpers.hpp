@@ -32,21 +32,56 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <utility>
 #include <vector>
 #include <iterator>
+#include <memory>
 #include <iostream>
 #include <string>
+#include <graphblas/Context.hpp>
 #include <graphblas/algebra.hpp>
 #include <graphblas/indices.hpp>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 //****************************************************************************
 
 namespace grb
 {
     namespace backend
     {
+        //**********************************************************************
+        /// Number of threads available to the next parallel region (1 when
+        /// compiled without OpenMP).
+        inline int num_threads()
+        {
+#if defined(_OPENMP)
+            return omp_get_max_threads();
+#else
+            return 1;
+#endif
+        }
+
+        static constexpr IndexType BITS_PER_WORD = 64;
+
+        //**********************************************************************
+        /// The entries of a sorted row whose index is in [lo, hi), as a pair
+        /// of iterators.
+        template <typename RowT>
+        auto row_slice(RowT const &row, IndexType lo, IndexType hi)
+        {
+            auto below = [](auto const &elt, IndexType j)
+                { return std::get<0>(elt) < j; };
+            auto first(std::lower_bound(row.begin(), row.end(), lo, below));
+            auto last(std::lower_bound(first, row.end(), hi, below));
+            return std::make_pair(first, last);
+        }
+
         template <typename ScalarT>
         void print_vec(std::ostream &os, std::string label,
                        std::vector<std::tuple<IndexType, ScalarT> > vec)
@@ -70,30 +105,229 @@ namespace grb
                          SrcMatrixT const &srcMatrix)
         {
             using DstScalarType = typename DstMatrixT::ScalarType;
-            std::vector<std::tuple<IndexType, DstScalarType> > dstRow;
 
             // Copying removes the contents of the other matrix so clear it first.
             dstMatrix.clear();
 
+            // Each thread writes its own rows in place; nvals fixed up below.
             IndexType nrows(dstMatrix.nrows());
+#pragma omp parallel for schedule(dynamic, 64)
             for (IndexType row_idx = 0; row_idx < nrows; ++row_idx)
             {
                 auto&& srcRow = srcMatrix[row_idx];
-                dstRow.clear();
+                auto &dstRow(dstMatrix[row_idx]);
 
                 // We need to construct a new row with the appropriate cast!
+                dstRow.reserve(srcRow.size());
                 for (auto&& [idx, srcVal] : srcRow)
                 {
                     dstRow.emplace_back(idx, static_cast<DstScalarType>(srcVal));
                 }
+            }
+            dstMatrix.recomputeNvals();
+        }
+
+        //**********************************************************************
+        /// Build a sorted list of (index, value) tuples from independent
+        /// per-index work: row_fn(idx, out) may append the tuple for idx to
+        /// out.  The range [0, n) is cut into contiguous blocks that threads
+        /// pick up dynamically; each block appends to its own list and the
+        /// lists are concatenated in block order.
+        template <typename TupleT,
+                  typename RowFnT>
+        void parallel_gather_rows(std::vector<TupleT> &t,
+                                  IndexType            n,
+                                  RowFnT               row_fn)
+        {
+            IndexType nblocks(std::max<IndexType>(
+                1, std::min<IndexType>(4*num_threads(), n)));
+            std::vector<std::vector<TupleT>> t_parts(nblocks);
+
+#pragma omp parallel for schedule(dynamic, 1)
+            for (IndexType b = 0; b < nblocks; ++b)
+            {
+                IndexType end((n * (b + 1)) / nblocks);
+                for (IndexType idx = (n * b) / nblocks; idx < end; ++idx)
+                {
+                    row_fn(idx, t_parts[b]);
+                }
+            }
 
-                if (!dstRow.empty())
-                    dstMatrix.setRow(row_idx, dstRow);
+            t.clear();
+            for (auto &part : t_parts)
+            {
+                t.insert(t.end(), part.begin(), part.end());
             }
         }
 
         // @todo: Make a sparse copy where they are the same type for efficiency
 
+        //**********************************************************************
+        /// T := A' for a LilSparseMatrix (or a matrix with the same row
+        /// interface).  The columns of A are split into one contiguous range
+        /// per thread; each thread scans every row of A for the entries in
+        /// its range (see row_slice), so each row of T is counted,
+        /// allocated once and filled in order by a single thread.  The only
+        /// extra storage is one count per column.
+        template <typename TMatrixT,
+                  typename AMatrixT>
+        void parallel_transpose(TMatrixT &T, AMatrixT const &A)
+        {
+            using TScalarType = typename TMatrixT::ScalarType;
+
+            IndexType nrows(A.nrows());
+            IndexType ncols(A.ncols());
+            T.clear();
+
+            IndexType nblocks(std::max<IndexType>(
+                1, std::min<IndexType>(num_threads(), ncols)));
+
+#pragma omp parallel for schedule(static, 1)
+            for (IndexType b = 0; b < nblocks; ++b)
+            {
+                IndexType col_begin((ncols * b) / nblocks);
+                IndexType col_end((ncols * (b + 1)) / nblocks);
+
+                std::vector<IndexType> counts(col_end - col_begin, 0);
+                for (IndexType i = 0; i < nrows; ++i)
+                {
+                    auto [first, last] = row_slice(A[i], col_begin, col_end);
+                    for (auto it = first; it != last; ++it)
+                    {
+                        ++counts[std::get<0>(*it) - col_begin];
+                    }
+                }
+                for (IndexType j = col_begin; j < col_end; ++j)
+                {
+                    T[j].reserve(counts[j - col_begin]);
+                }
+
+                for (IndexType i = 0; i < nrows; ++i)
+                {
+                    auto [first, last] = row_slice(A[i], col_begin, col_end);
+                    for (auto it = first; it != last; ++it)
+                    {
+                        T[std::get<0>(*it)].emplace_back(
+                            i, static_cast<TScalarType>(std::get<1>(*it)));
+                    }
+                }
+            }
+            T.recomputeNvals();
+        }
+
+        //**********************************************************************
+        /// Reduce per-index contributions with a monoid: row_fn(idx, tmp)
+        /// stores the contribution of idx in tmp and returns false if there
+        /// is none.  [0, n) is cut into contiguous blocks; each block folds
+        /// its contributions (seeded from the first one) with its own copy of
+        /// row_fn, so a mutable lambda can carry scratch space.  The partials
+        /// are combined in block order.  Once any partial reaches the
+        /// terminal value of the monoid the remaining work is skipped.
+        ///
+        /// @retval true  if any index contributed (ans holds the result)
+        template <typename ZScalarT,
+                  typename MonoidT,
+                  typename RowFnT>
+        bool parallel_reduce_rows(ZScalarT  &ans,
+                                  IndexType  n,
+                                  MonoidT    monoid,
+                                  RowFnT     row_fn)
+        {
+            IndexType nblocks(std::max<IndexType>(
+                1, std::min<IndexType>(4*num_threads(), n)));
+            std::unique_ptr<ZScalarT[]> partial(new ZScalarT[nblocks]);
+            std::unique_ptr<uint8_t[]>  partial_set(new uint8_t[nblocks]);
+            bool done(false);
+
+#pragma omp parallel for schedule(dynamic, 1)
+            for (IndexType b = 0; b < nblocks; ++b)
+            {
+                RowFnT block_fn(row_fn);
+                ZScalarT z, tmp;
+                bool z_set(false);
+                IndexType end((n * (b + 1)) / nblocks);
+                for (IndexType idx = (n * b) / nblocks; idx < end; ++idx)
+                {
+                    bool stop;
+#pragma omp atomic read
+                    stop = done;
+                    if (stop) break;
+
+                    if (!block_fn(idx, tmp)) continue;
+                    z = z_set ? monoid(z, tmp) : tmp;
+                    z_set = true;
+                    if (is_terminal(monoid, z))
+                    {
+#pragma omp atomic write
+                        done = true;
+                    }
+                }
+                partial[b] = z;
+                partial_set[b] = z_set;
+            }
+
+            bool ans_set(false);
+            for (IndexType b = 0; b < nblocks; ++b)
+            {
+                if (partial_set[b])
+                {
+                    ans = ans_set ? monoid(ans, partial[b]) : partial[b];
+                    ans_set = true;
+                }
+            }
+            return ans_set;
+        }
+
+        //**********************************************************************
+        /// Number of blocks parallel_axpy_rows uses for n outputs
+        inline IndexType num_axpy_blocks(IndexType n)
+        {
+            IndexType nwords((n + BITS_PER_WORD - 1)/BITS_PER_WORD);
+            return std::max<IndexType>(
+                1, std::min<IndexType>(num_threads(), nwords));
+        }
+
+        //**********************************************************************
+        /// Column-parallel driver for the axpy (scatter) form of t = u +.* A
+        /// where A is stored by rows and t has n elements.  The output range
+        /// is split into one block per thread with edges on 64-bit word
+        /// boundaries (so blocks never share a packed word), and every block
+        /// calls slice_fn(b, k, first, last) for each stored u(k) with the
+        /// entries [first, last) of A[k] that land in the block.  Rows are
+        /// visited in order within a block, so each output element sees the
+        /// same sequence of updates as a sequential loop.
+        template <typename UVectorT,
+                  typename AMatrixT,
+                  typename SliceFnT>
+        void parallel_axpy_rows(IndexType        n,
+                                UVectorT const  &u,
+                                AMatrixT const  &A,
+                                SliceFnT         slice_fn)
+        {
+            // The rows of A that contribute
+            std::vector<IndexType> rows;
+            auto const &u_bits(u.get_bitmap());
+            for (IndexType k = 0; k < u.size(); ++k)
+            {
+                if (u_bits[k] && !A[k].empty()) rows.push_back(k);
+            }
+
+            IndexType nblocks(num_axpy_blocks(n));
+            IndexType nwords((n + BITS_PER_WORD - 1)/BITS_PER_WORD);
+
+#pragma omp parallel for schedule(static, 1)
+            for (IndexType b = 0; b < nblocks; ++b)
+            {
+                IndexType lo(std::min(n, ((nwords*b)/nblocks)*BITS_PER_WORD));
+                IndexType hi(std::min(n, ((nwords*(b+1))/nblocks)*BITS_PER_WORD));
+                for (IndexType k : rows)
+                {
+                    auto [first, last] = row_slice(A[k], lo, hi);
+                    if (first != last) slice_fn(b, k, first, last);
+                }
+            }
+        }
+
         //**********************************************************************
         /// Advance the provided iterator until the value evaluates to true or
         /// the end is reached.
@@ -184,6 +418,9 @@ namespace grb
                         value_set = true;
                     }
 
+                    // stop if the add monoid reached its terminal value
+                    if (is_terminal(op, ans)) break;
+
                     do { ++u_idx; } while ((u_idx < u_vals.size()) && !u_bitmap[u_idx]);
                     ++A_iter;
                 }
@@ -236,6 +473,9 @@ namespace grb
                         value_set = true;
                     }
 
+                    // stop if the add monoid reached its terminal value
+                    if (is_terminal(op, ans)) break;
+
                     ++v2_it;
                     ++v1_it;
                 }
@@ -288,6 +528,9 @@ namespace grb
                         value_set = true;
                     }
 
+                    // stop if the add monoid reached its terminal value
+                    if (is_terminal(op, ans)) break;
+
                     ++v2_it;
                     ++v1_it;
                 }
@@ -333,7 +576,9 @@ namespace grb
                 tmp = op(std::get<1>(vec[0]), std::get<1>(vec[1]));
 
                 /// @todo replace with call to std::reduce?
-                for (size_t idx = 2; idx < vec.size(); ++idx)
+                for (size_t idx = 2;
+                     (idx < vec.size()) && !is_terminal(op, tmp);
+                     ++idx)
                 {
                     tmp = op(tmp, std::get<1>(vec[idx]));
                 }
@@ -591,6 +836,7 @@ namespace grb
             ZRowType tmp_row;
             IndexType nRows(Z.nrows());
 
+#pragma omp parallel for schedule(dynamic, 64) private(tmp_row)
             for (IndexType row_idx = 0; row_idx < nRows; ++row_idx)
             {
                 ewise_or(tmp_row, C[row_idx], T[row_idx], accum);
@@ -619,6 +865,7 @@ namespace grb
             ZRowType tmp_row;
             IndexType nRows(Z.nrows());
 
+#pragma omp parallel for schedule(dynamic, 64) private(tmp_row)
             for (IndexType row_idx = 0; row_idx < nRows; ++row_idx)
             {
                 if (searchIndices(row_indices, row_idx))
@@ -653,6 +900,7 @@ namespace grb
             ZRowType tmp_row;
             IndexType nRows(Z.nrows());
 
+#pragma omp parallel for schedule(dynamic, 64) private(tmp_row)
             for (IndexType row_idx = 0; row_idx < nRows; ++row_idx)
             {
                 ewise_or(tmp_row, C[row_idx], T[row_idx], accum);
@@ -795,7 +1043,11 @@ namespace grb
          * @param result   Result vector.  We clear this first.
          * @param c_vec    The original c values that may be carried through.
          * @param z_vec    The new values to insert/overlay.
-         * @param mask_vec The mask which specifies which values to use.
+         * @param mask_vec The original (uncomplemented) sparse mask row.
+         * @param structure_flag  If true, only the structure of the mask is used.
+         * @param complement_flag If true, the mask is complemented.  This is
+         *                 evaluated lazily so the complement is never
+         *                 materialized; cost is O(nnz(C) + nnz(Z) + nnz(M)).
          * @param outp     If REPLACE, we should always clear the values specified
          *                 by the mask regardless if they are overlayed.
          */
@@ -807,6 +1059,8 @@ namespace grb
             std::vector<std::tuple<IndexType, CScalarT> > const    &c_vec,
             std::vector<std::tuple<IndexType, ZScalarT> > const    &z_vec,
             std::vector<std::tuple<IndexType, MScalarT> > const    &mask_vec,
+            bool                                                    structure_flag,
+            bool                                                    complement_flag,
             OutputControlEnum                                       outp)
         {
             auto c_it = c_vec.begin();
@@ -815,62 +1069,54 @@ namespace grb
 
             result.clear();
 
-            // Design: This approach is driven by the mask.
-            while (mask_it != mask_vec.end())
+            // Design: This approach is driven by the union of C and Z.
+            while ((c_it != c_vec.end()) || (z_it != z_vec.end()))
             {
-                // Make sure the mask is on a valid value
-                increment_until_true(mask_it, mask_vec.end());
-
-                // If we run out of mask, we are done!
-                if (mask_it == mask_vec.end())
+                bool c_here, z_here;
+                IndexType idx;
+                if (z_it == z_vec.end())
                 {
-                    break;
+                    idx = std::get<0>(*c_it);
                 }
-
-                // Get the mask location
-                auto mask_idx(std::get<0>(*mask_it));
-
-                // If outp==REPLACE, then we don't consider original C values.
-                // If outp==MERGE, then we want to keep C values outside the mask
-                // Any values in C "outside" the mask should now be applied
-                // So, we catch "c" up to the mask.  This is the intersection
-                // of C and !M.
-
-                if (outp == MERGE)
+                else if (c_it == c_vec.end())
                 {
-                    // This is the part of (ind(C) \cap int(\not M)
-                    increment_and_add_while_below(c_it, c_vec.end(), mask_idx,
-                                                  result);
+                    idx = std::get<0>(*z_it);
                 }
-
-                // "Catch up" the input to the mask.
-                if (increment_while_below(z_it, z_vec.end(), mask_idx))
+                else
                 {
-                    // Now, at the mask point add the value from Z if we have one.
-                    result.emplace_back(
-                        mask_idx, static_cast<CScalarT>(std::get<1>(*z_it)));
+                    idx = std::min(std::get<0>(*c_it), std::get<0>(*z_it));
                 }
+                c_here = ((c_it != c_vec.end()) && (std::get<0>(*c_it) == idx));
+                z_here = ((z_it != z_vec.end()) && (std::get<0>(*z_it) == idx));
 
-                // If there is a C here, skip it
-                if (c_it != c_vec.end())
+                // Catch the mask up to idx and evaluate it there
+                while ((mask_it != mask_vec.end()) &&
+                       (std::get<0>(*mask_it) < idx))
                 {
-                    if (std::get<0>(*c_it) == mask_idx)
-                        ++c_it;
+                    ++mask_it;
                 }
+                bool mask_val = ((mask_it != mask_vec.end()) &&
+                                 (std::get<0>(*mask_it) == idx) &&
+                                 (structure_flag ||
+                                  static_cast<bool>(std::get<1>(*mask_it))));
 
-                // Now move to the next mask entry.
-                ++mask_it;
-            } // while mask_it != end
-
-            // Now, we need to add the remaining C values beyond the mask
-            if (outp == MERGE)
-            {
-                // This is the part of (ind(C) \cap int(\not M)
-                while (c_it != c_vec.end())
+                if (mask_val != complement_flag)
+                {
+                    // Inside the mask: Z wins (or the entry is deleted)
+                    if (z_here)
+                    {
+                        result.emplace_back(
+                            idx, static_cast<CScalarT>(std::get<1>(*z_it)));
+                    }
+                }
+                else if (c_here && (outp == MERGE))
                 {
+                    // Outside the mask: keep C when merging
                     result.emplace_back(*c_it);
-                    ++c_it;
                 }
+
+                if (c_here) ++c_it;
+                if (z_here) ++z_it;
             }
         } // apply_with_mask
 
@@ -879,182 +1125,140 @@ namespace grb
         //**********************************************************************
 
         //**********************************************************************
-        // WARNING: costly
-        template <typename MatrixT>
-        decltype(auto)
-        get_structure_row(MatrixT const &mat, IndexType row_idx)
+        // The sparse data underlying a (possibly view) mask
+        template <typename MaskT>
+        decltype(auto) get_mask_matrix(MaskT const &Mask)
         {
-            std::vector<std::tuple<IndexType, bool> > mask_tuples;
-            mask_tuples.reserve(mat.ncols() - mat[row_idx].size());
-
-            for (auto&& [ix, val] : mat[row_idx])
-            {
-                mask_tuples.emplace_back(ix, true);
-            }
-
-            return mask_tuples;
+            if constexpr (is_complement_v<MaskT> ||
+                          is_structure_v<MaskT> ||
+                          is_structural_complement_v<MaskT>)
+                return (Mask.m_mat);
+            else
+                return (Mask);
         }
 
-        //**********************************************************************
-        // WARNING: costly
-        template <typename MatrixT>
-        decltype(auto)
-        get_complement_row(MatrixT const &mat, IndexType row_idx)
+        template <typename MaskT>
+        decltype(auto) get_mask_vector(MaskT const &mask)
         {
-            std::vector<std::tuple<IndexType, bool> > mask_tuples;
-            auto &row_tuples = mat[row_idx];
-            mask_tuples.reserve(mat.ncols() - row_tuples.size());
-            auto it = row_tuples.begin();
-
-            for (IndexType ix = 0; ix < mat.ncols(); ++ix)
-            {
-                if ((it == row_tuples.end()) || (ix < std::get<0>(*it)))
-                {
-                    mask_tuples.emplace_back(ix, true);
-                }
-                else
-                {
-                    if (static_cast<bool>(std::get<1>(*it)) == false)
-                    {
-                        mask_tuples.emplace_back(ix, true);
-                    }
-                    ++it;
-                }
-            }
-
-            return mask_tuples;
+            if constexpr (is_complement_v<MaskT> ||
+                          is_structure_v<MaskT> ||
+                          is_structural_complement_v<MaskT>)
+                return (mask.m_vec);
+            else
+                return (mask);
         }
 
         //**********************************************************************
-        // WARNING: costly
-        template <typename MatrixT>
-        decltype(auto)
-        get_structural_complement_row(MatrixT const &mat, IndexType row_idx)
-        {
-            std::vector<std::tuple<IndexType, bool> > mask_tuples;
-            auto &row_tuples = mat[row_idx];
-            mask_tuples.reserve(mat.ncols() - row_tuples.size());
-            auto it = row_tuples.begin();
-
-            for (IndexType ix = 0; ix < mat.ncols(); ++ix)
-            {
-                if ((it == row_tuples.end()) || (ix < std::get<0>(*it)))
-                {
-                    mask_tuples.emplace_back(ix, true);
-                }
-                else
-                {
-                    ++it;
-                }
-            }
+        // How the sparse data of a (possibly view) mask is interpreted
+        template <typename MaskT>
+        inline constexpr bool mask_structure_flag_v =
+            is_structure_v<MaskT> || is_structural_complement_v<MaskT>;
 
-            return mask_tuples;
-        }
+        template <typename MaskT>
+        inline constexpr bool mask_complement_flag_v =
+            is_complement_v<MaskT> || is_structural_complement_v<MaskT>;
 
         //**********************************************************************
-        // Matrix version
-        template < typename CMatrixT,
-                   typename ZMatrixT,
-                   typename MMatrixT>
-        void write_with_opt_mask(CMatrixT           &C,
-                                 ZMatrixT   const   &Z,
-                                 MMatrixT   const   &Mask,
-                                 OutputControlEnum   outp)
+        // Row-level fast paths shared by the masked writes.  Returns true if
+        // the result row is known without merging: either it is unchanged
+        // (leave C alone) or it is empty (clear C's row).
+        template <typename CRowT, typename ZRowT, typename MRowT>
+        bool masked_row_shortcut(CRowT       const &c_row,
+                                 ZRowT       const &z_row,
+                                 MRowT       const &m_row,
+                                 bool               complement_flag,
+                                 OutputControlEnum  outp,
+                                 bool              &clear_row)
         {
-            using CScalarType = typename CMatrixT::ScalarType;
-            using CRowType = std::vector<std::tuple<IndexType, CScalarType> >;
+            clear_row = false;
 
-            CRowType tmp_row;
-            IndexType nRows(C.nrows());
-            for (IndexType row_idx = 0; row_idx < nRows; ++row_idx)
-            {
-                apply_with_mask(tmp_row, C[row_idx], Z[row_idx],
-                                Mask[row_idx], outp);
+            // Nothing in, nothing out
+            if (c_row.empty() && z_row.empty()) return true;
 
-                // Now, set the new one.  Yes, we can optimize this later
-                C.setRow(row_idx, tmp_row);
+            // An empty (uncomplemented) mask row blocks every write: merge
+            // keeps C as is and replace clears it.
+            if (!complement_flag && m_row.empty())
+            {
+                clear_row = ((outp == REPLACE) && !c_row.empty());
+                return true;
             }
+            return false;
         }
 
         //**********************************************************************
-        // Matrix version specialized for complement mask
-        template < typename CMatrixT,
-                   typename ZMatrixT,
-                   typename MMatrixT>
-        void write_with_opt_mask(
-            CMatrixT                                  &C,
-            ZMatrixT                            const &Z,
-            grb::MatrixComplementView<MMatrixT> const &Mask,
-            OutputControlEnum                          outp)
+        // Collect the rows of C that a masked write can change, so the
+        // (parallel) row loop only visits those.  A row is skipped when C and
+        // the result are both empty, when an accumulated merge has nothing
+        // to add (skip_empty_z), or when an uncomplemented mask row is empty
+        // and there is nothing in C for a replace to clear.  Complemented
+        // masks still visit every non-empty row of C.
+        template <typename CMatrixT, typename ZMatrixT, typename MMatrixT>
+        void masked_candidate_rows(std::vector<IndexType>       &rows,
+                                   CMatrixT               const &C,
+                                   ZMatrixT               const &Z,
+                                   MMatrixT               const &M,
+                                   bool                   complement_flag,
+                                   bool                   skip_empty_z,
+                                   OutputControlEnum      outp)
         {
-            using CScalarType = typename CMatrixT::ScalarType;
-            using CRowType = std::vector<std::tuple<IndexType, CScalarType> >;
-
-            CRowType tmp_row;
-            IndexType nRows(C.nrows());
-            for (IndexType row_idx = 0; row_idx < nRows; ++row_idx)
+            rows.clear();
+            for (IndexType row_idx = 0; row_idx < C.nrows(); ++row_idx)
             {
-                apply_with_mask(tmp_row, C[row_idx], Z[row_idx],
-                                get_complement_row(Mask.m_mat, row_idx),
-                                outp);
+                bool c_empty(C[row_idx].empty());
+                bool z_empty(Z[row_idx].empty());
+
+                if (c_empty && z_empty) continue;
+                if (skip_empty_z && z_empty && (outp == MERGE)) continue;
+                if (!complement_flag && M[row_idx].empty() &&
+                    ((outp == MERGE) || c_empty)) continue;
 
-                // Now, set the new one.  Yes, we can optimize this later
-                C.setRow(row_idx, tmp_row);
+                rows.push_back(row_idx);
             }
         }
 
         //**********************************************************************
-        // Matrix version specialized for structure mask
+        // Matrix version (plain, structure, complement and structural
+        // complement masks).  Only rows that can change are rewritten.
         template < typename CMatrixT,
                    typename ZMatrixT,
-                   typename MMatrixT>
-        void write_with_opt_mask(
-            CMatrixT                                 &C,
-            ZMatrixT                           const &Z,
-            grb::MatrixStructureView<MMatrixT> const &Mask,
-            OutputControlEnum                         outp)
+                   typename MaskT>
+        void write_with_opt_mask(CMatrixT           &C,
+                                 ZMatrixT   const   &Z,
+                                 MaskT      const   &Mask,
+                                 OutputControlEnum   outp)
         {
             using CScalarType = typename CMatrixT::ScalarType;
             using CRowType = std::vector<std::tuple<IndexType, CScalarType> >;
 
-            CRowType tmp_row;
-            IndexType nRows(C.nrows());
-            for (IndexType row_idx = 0; row_idx < nRows; ++row_idx)
-            {
-                apply_with_mask(tmp_row, C[row_idx], Z[row_idx],
-                                get_structure_row(Mask.m_mat, row_idx),
-                                outp);
-
-                // Now, set the new one.  Yes, we can optimize this later
-                C.setRow(row_idx, tmp_row);
-            }
-        }
+            constexpr bool structure_flag = mask_structure_flag_v<MaskT>;
+            constexpr bool complement_flag = mask_complement_flag_v<MaskT>;
+            auto const &M(get_mask_matrix(Mask));
 
-        //**********************************************************************
-        // Matrix version specialized for structural complement mask
-        template < typename CMatrixT,
-                   typename ZMatrixT,
-                   typename MMatrixT>
-        void write_with_opt_mask(
-            CMatrixT                                            &C,
-            ZMatrixT                                      const &Z,
-            grb::MatrixStructuralComplementView<MMatrixT> const &Mask,
-            OutputControlEnum                                    outp)
-        {
-            using CScalarType = typename CMatrixT::ScalarType;
-            using CRowType = std::vector<std::tuple<IndexType, CScalarType> >;
+            std::vector<IndexType> rows;
+            masked_candidate_rows(rows, C, Z, M, complement_flag, false, outp);
 
-            CRowType tmp_row;
-            IndexType nRows(C.nrows());
-            for (IndexType row_idx = 0; row_idx < nRows; ++row_idx)
+            IndexType nCandidates(rows.size());
+#pragma omp parallel
             {
-                apply_with_mask(tmp_row, C[row_idx], Z[row_idx],
-                                get_structural_complement_row(Mask.m_mat, row_idx),
-                                outp);
+                CRowType tmp_row;
+                bool clear_row;
+#pragma omp for schedule(dynamic, 64)
+                for (IndexType k = 0; k < nCandidates; ++k)
+                {
+                    IndexType row_idx(rows[k]);
+                    if (masked_row_shortcut(C[row_idx], Z[row_idx], M[row_idx],
+                                            complement_flag, outp, clear_row))
+                    {
+                        if (clear_row) C[row_idx].clear();
+                        continue;
+                    }
 
-                // Now, set the new one.  Yes, we can optimize this later
-                C.setRow(row_idx, tmp_row);
+                    apply_with_mask(tmp_row, C[row_idx], Z[row_idx], M[row_idx],
+                                    structure_flag, complement_flag, outp);
+                    C[row_idx].swap(tmp_row);
+                }
             }
+            C.recomputeNvals();
         }
 
         //**********************************************************************
@@ -1074,77 +1278,88 @@ namespace grb
         //**********************************************************************
 
         //**********************************************************************
-        // WARNING: costly
-        template <typename VectorT>
-        decltype(auto)
-        get_structure_contents(VectorT const &vec)
+        /**
+         * @brief Vector version of the masked write: w<m,z> := w (accum) t.
+         *
+         * Works in place on the bitmaps of w and the mask in one pass over
+         * the indices, so neither w nor the mask is ever copied into a
+         * sparse tuple list (getContents).  Inside the (possibly
+         * complemented) mask w becomes z = w (accum) t, or just t without an
+         * accumulator; outside it w is kept (MERGE) or cleared (REPLACE).
+         *
+         * @param[in,out] w  The output vector
+         * @param[in]     t  The sorted sparse result to be written
+         * @param[in]     m  The (uncomplemented) mask vector
+         */
+        template <typename WVectorT,
+                  typename TScalarT,
+                  typename MVectorT,
+                  typename AccumT>
+        void apply_with_mask_1D(
+            WVectorT                                           &w,
+            std::vector<std::tuple<IndexType, TScalarT>> const &t,
+            MVectorT                                     const &m,
+            bool                                                structure_flag,
+            bool                                                complement_flag,
+            AccumT                                       const &accum,
+            OutputControlEnum                                   outp)
         {
-            std::vector<std::tuple<IndexType, bool> > mask_tuples;
+            using WScalarType = typename WVectorT::ScalarType;
+            using ZScalarType = std::conditional_t<
+                std::is_same_v<AccumT, NoAccumulate>,
+                TScalarT,
+                decltype(accum(std::declval<WScalarType>(),
+                               std::declval<TScalarT>()))>;
+
+            auto const &w_bits(w.get_bitmap());
+            auto const &w_vals(w.get_vals());
+            auto const &m_bits(m.get_bitmap());
+            auto const &m_vals(m.get_vals());
+            auto t_it = t.begin();
 
-            for (auto [ix, val] : vec.getContents())
+            for (IndexType idx = 0; idx < w.size(); ++idx)
             {
-                mask_tuples.emplace_back(ix, true);
-            }
-
-            return mask_tuples;
-        }
-
-        //**********************************************************************
-        // WARNING: costly
-        template <typename VectorT>
-        decltype(auto)
-        get_complement_contents(VectorT const &vec)
-        {
-            std::vector<std::tuple<IndexType, bool> > mask_tuples;
-            auto row_tuples(vec.getContents());
-            auto it = row_tuples.begin();
+                bool t_here((t_it != t.end()) && (std::get<0>(*t_it) == idx));
+                bool mask_val(m_bits[idx] &&
+                              (structure_flag || static_cast<bool>(m_vals[idx])));
 
-            for (IndexType ix = 0; ix < vec.size(); ++ix)
-            {
-                if ((it == row_tuples.end()) || (ix < std::get<0>(*it)))
-                {
-                    mask_tuples.emplace_back(ix, true);
-                }
-                else
+                if (mask_val != complement_flag)
                 {
-                    if (static_cast<bool>(std::get<1>(*it)) == false)
+                    // Inside the mask: z wins (or the entry is deleted)
+                    if (t_here)
+                    {
+                        ZScalarType z_val;
+                        if constexpr (!std::is_same_v<AccumT, NoAccumulate>)
+                        {
+                            z_val = (w_bits[idx] ?
+                                     accum(w_vals[idx], std::get<1>(*t_it)) :
+                                     static_cast<ZScalarType>(std::get<1>(*t_it)));
+                        }
+                        else
+                        {
+                            z_val = std::get<1>(*t_it);
+                        }
+                        w.setElement(idx, static_cast<WScalarType>(z_val));
+                    }
+                    else if (std::is_same_v<AccumT, NoAccumulate> && w_bits[idx])
                     {
-                        mask_tuples.emplace_back(ix, true);
+                        // without accum z has nothing here; with accum z = w
+                        w.removeElement(idx);
                     }
-                    ++it;
-                }
-            }
-
-            return mask_tuples;
-        }
-
-        //**********************************************************************
-        // WARNING: costly
-        template <typename VectorT>
-        decltype(auto)
-        get_structural_complement_contents(VectorT const &vec)
-        {
-            std::vector<std::tuple<IndexType, bool> > mask_tuples;
-            auto row_tuples(vec.getContents());
-            auto it = row_tuples.begin();
-
-            for (IndexType ix = 0; ix < vec.size(); ++ix)
-            {
-                if ((it == row_tuples.end()) || (ix < std::get<0>(*it)))
-                {
-                    mask_tuples.emplace_back(ix, true);
                 }
-                else
+                else if ((outp == REPLACE) && w_bits[idx])
                 {
-                    ++it;
+                    // Outside the mask: keep w only when merging
+                    w.removeElement(idx);
                 }
-            }
 
-            return mask_tuples;
+                if (t_here) ++t_it;
+            }
         }
 
         //**********************************************************************
-        // Vector version
+        // Vector version (plain, structure, complement and structural
+        // complement masks)
         template <typename WVectorT,
                   typename ZScalarT,
                   typename MaskT>
@@ -1154,82 +1369,22 @@ namespace grb
             MaskT const                                        &mask,
             OutputControlEnum                                   outp)
         {
-            using WScalarType = typename WVectorT::ScalarType;
-            std::vector<std::tuple<IndexType, WScalarType> > tmp_row;
-
-            apply_with_mask(tmp_row, w.getContents(), z,
-                            mask.getContents(),
-                            outp);
-
-            // Now, set the new one.  Yes, we can optimize this later
-            w.setContents(tmp_row);
-        }
-
-        //**********************************************************************
-        // Vector version specialized for complement mask
-        template <typename WVectorT,
-                  typename ZScalarT,
-                  typename MaskT>
-        void write_with_opt_mask_1D(
-            WVectorT                                           &w,
-            std::vector<std::tuple<IndexType, ZScalarT>> const &z,
-            grb::VectorComplementView<MaskT>             const &mask,
-            OutputControlEnum                                   outp)
-        {
-            using WScalarType = typename WVectorT::ScalarType;
-            std::vector<std::tuple<IndexType, WScalarType> > tmp_row;
-
-            apply_with_mask(tmp_row, w.getContents(), z,
-                            get_complement_contents(mask.m_vec),
-                            outp);
-
-            // Now, set the new one.  Yes, we can optimize this later
-            w.setContents(tmp_row);
-        }
-
-        //**********************************************************************
-        // Vector version specialized for structure mask
-        template <typename WVectorT,
-                  typename ZScalarT,
-                  typename MaskT>
-        void write_with_opt_mask_1D(
-            WVectorT                                           &w,
-            std::vector<std::tuple<IndexType, ZScalarT>> const &z,
-            grb::VectorStructureView<MaskT>              const &mask,
-            OutputControlEnum                                   outp)
-        {
-            using WScalarType = typename WVectorT::ScalarType;
-            std::vector<std::tuple<IndexType, WScalarType> > tmp_row;
-
-            apply_with_mask(tmp_row, w.getContents(), z,
-                            get_structure_contents(mask.m_vec),
-                            outp);
-
-            // Now, set the new one.  Yes, we can optimize this later
-            w.setContents(tmp_row);
-        }
+            constexpr bool structure_flag = mask_structure_flag_v<MaskT>;
+            constexpr bool complement_flag = mask_complement_flag_v<MaskT>;
+            auto const &m(get_mask_vector(mask));
 
+            // Nothing in, nothing out
+            if ((w.nvals() == 0) && z.empty()) return;
 
-        //**********************************************************************
-        // Vector version specialized for structural complement mask
-        template <typename WVectorT,
-                  typename ZScalarT,
-                  typename MaskT>
-        void write_with_opt_mask_1D(
-            WVectorT                                               &w,
-            std::vector<std::tuple<IndexType, ZScalarT>>     const &z,
-            grb::VectorStructuralComplementView<MaskT>       const &mask,
-            OutputControlEnum                                       outp)
-        {
-            using WScalarType = typename WVectorT::ScalarType;
-            std::vector<std::tuple<IndexType, WScalarType> > tmp_row;
-
-            apply_with_mask(tmp_row, w.getContents(), z,
-                            get_structural_complement_contents(mask.m_vec),
-                            outp);
+            // An empty (uncomplemented) mask blocks every write
+            if (!complement_flag && (m.nvals() == 0))
+            {
+                if (outp == REPLACE) w.clear();
+                return;
+            }
 
-            // Now, set the new one.  Yes, we can optimize this later
-            w.setContents(tmp_row);
+            apply_with_mask_1D(w, z, m, structure_flag, complement_flag,
+                               NoAccumulate(), outp);
         }
 
         //**********************************************************************
@@ -1246,10 +1401,182 @@ namespace grb
             w.setContents(z);
         }
 
-        //********************************************************************
-        // Index-out-of-bounds is an execution error and a responsibility of
-        // the backend.
-        template <typename SequenceT>
+        //**********************************************************************
+        // Fused Output Stage: C<M,z> := C (accum) T
+        //**********************************************************************
+        // Performs ewise_or_opt_accum followed by write_with_opt_mask one row
+        // at a time, directly into C, so the Z matrix is never built.  Rows
+        // whose result is known to equal the current contents of C are
+        // skipped.
+
+        //**********************************************************************
+        // Matrix version
+        template <typename CMatrixT,
+                  typename TMatrixT,
+                  typename MaskT,
+                  typename AccumT>
+        void write_with_opt_accum_mask(CMatrixT           &C,
+                                       TMatrixT   const   &T,
+                                       MaskT      const   &Mask,
+                                       AccumT     const   &accum,
+                                       OutputControlEnum   outp)
+        {
+            using CScalarType = typename CMatrixT::ScalarType;
+            using TScalarType = typename TMatrixT::ScalarType;
+            using ZScalarType = std::conditional_t<
+                std::is_same_v<AccumT, NoAccumulate>,
+                TScalarType,
+                decltype(accum(std::declval<CScalarType>(),
+                               std::declval<TScalarType>()))>;
+            constexpr bool has_accum = !std::is_same_v<AccumT, NoAccumulate>;
+
+            IndexType nRows(C.nrows());
+
+            if constexpr (std::is_same_v<MaskT, NoMask>)
+            {
+                if constexpr (!has_accum)
+                {
+                    sparse_copy(C, T);
+                }
+                else
+                {
+#pragma omp parallel
+                    {
+                        std::vector<std::tuple<IndexType, ZScalarType> > z_row;
+#pragma omp for schedule(dynamic, 64)
+                        for (IndexType row_idx = 0; row_idx < nRows; ++row_idx)
+                        {
+                            // C (accum) <empty> == C
+                            if (T[row_idx].empty()) continue;
+
+                            ewise_or(z_row, C[row_idx], T[row_idx], accum);
+                            auto &c_row(C[row_idx]);
+                            c_row.clear();
+                            for (auto&& [idx, val] : z_row)
+                            {
+                                c_row.emplace_back(
+                                    idx, static_cast<CScalarType>(val));
+                            }
+                        }
+                    }
+                    C.recomputeNvals();
+                }
+            }
+            else
+            {
+                constexpr bool structure_flag = mask_structure_flag_v<MaskT>;
+                constexpr bool complement_flag = mask_complement_flag_v<MaskT>;
+                auto const &M(get_mask_matrix(Mask));
+
+                std::vector<IndexType> rows;
+                masked_candidate_rows(rows, C, T, M, complement_flag,
+                                      has_accum, outp);
+
+                IndexType nCandidates(rows.size());
+#pragma omp parallel
+                {
+                    std::vector<std::tuple<IndexType, ZScalarType> > z_row;
+                    std::vector<std::tuple<IndexType, CScalarType> > c_row;
+                    bool clear_row;
+#pragma omp for schedule(dynamic, 64)
+                    for (IndexType k = 0; k < nCandidates; ++k)
+                    {
+                        IndexType row_idx(rows[k]);
+                        auto const &t_row(T[row_idx]);
+                        if (masked_row_shortcut(C[row_idx], t_row, M[row_idx],
+                                                complement_flag, outp,
+                                                clear_row))
+                        {
+                            if (clear_row) C[row_idx].clear();
+                            continue;
+                        }
+
+                        if constexpr (has_accum)
+                        {
+                            ewise_or(z_row, C[row_idx], t_row, accum);
+                            apply_with_mask(c_row, C[row_idx], z_row,
+                                            M[row_idx], structure_flag,
+                                            complement_flag, outp);
+                        }
+                        else
+                        {
+                            apply_with_mask(c_row, C[row_idx], t_row,
+                                            M[row_idx], structure_flag,
+                                            complement_flag, outp);
+                        }
+                        C[row_idx].swap(c_row);
+                    }
+                }
+                C.recomputeNvals();
+            }
+        }
+
+        //**********************************************************************
+        // Vector version
+        template <typename WVectorT,
+                  typename TScalarT,
+                  typename MaskT,
+                  typename AccumT>
+        void write_with_opt_accum_mask_1D(
+            WVectorT                                           &w,
+            std::vector<std::tuple<IndexType, TScalarT>> const &t,
+            MaskT                                        const &mask,
+            AccumT                                       const &accum,
+            OutputControlEnum                                   outp)
+        {
+            using WScalarType = typename WVectorT::ScalarType;
+            using ZScalarType = std::conditional_t<
+                std::is_same_v<AccumT, NoAccumulate>,
+                TScalarT,
+                decltype(accum(std::declval<WScalarType>(),
+                               std::declval<TScalarT>()))>;
+            constexpr bool has_accum = !std::is_same_v<AccumT, NoAccumulate>;
+
+            if (t.empty())
+            {
+                // Nothing in, nothing out
+                if (w.nvals() == 0) return;
+
+                // w (accum) <empty> == w and merge keeps w outside the mask
+                if (has_accum &&
+                    (std::is_same_v<MaskT, NoMask> || (outp == MERGE))) return;
+            }
+
+            if constexpr (std::is_same_v<MaskT, NoMask>)
+            {
+                if constexpr (has_accum)
+                {
+                    std::vector<std::tuple<IndexType, ZScalarType> > z;
+                    ewise_or(z, w.getContents(), t, accum);
+                    w.setContents(z);
+                }
+                else
+                {
+                    w.setContents(t);
+                }
+            }
+            else
+            {
+                constexpr bool structure_flag = mask_structure_flag_v<MaskT>;
+                constexpr bool complement_flag = mask_complement_flag_v<MaskT>;
+
+                // An empty (uncomplemented) mask blocks every write
+                if (!complement_flag && (get_mask_vector(mask).nvals() == 0))
+                {
+                    if (outp == REPLACE) w.clear();
+                    return;
+                }
+
+                apply_with_mask_1D(w, t, get_mask_vector(mask),
+                                   structure_flag, complement_flag,
+                                   accum, outp);
+            }
+        }
+
+        //********************************************************************
+        // Index-out-of-bounds is an execution error and a responsibility of
+        // the backend.
+        template <typename SequenceT>
         void check_index_array_content(SequenceT   const &array,
                                        IndexType          dim,
                                        std::string const &msg)
@@ -1369,45 +1696,65 @@ namespace grb
         /// perform the following operation on sparse vectors implemented as
         /// vector<tuple<Index, value>>
         ///
-        /// c += a_ik*b[:]
+        /// c += a_ik*b[first:last]
         template<typename CScalarT,
                  typename SemiringT,
                  typename AScalarT,
-                 typename BScalarT>
+                 typename BIteratorT>
         void axpy(
             std::vector<std::tuple<IndexType, CScalarT>>       &c,
             SemiringT                                           semiring,
             AScalarT                                            a,
-            std::vector<std::tuple<IndexType, BScalarT>> const &b)
+            BIteratorT                                          first,
+            BIteratorT                                          last)
         {
             GRB_LOG_FN_BEGIN("axpy");
             auto c_it = c.begin();
 
-            for (auto&& [j, b_j] : b)
+            for (auto it = first; it != last; ++it)
             {
+                auto&& [j, b_j] = *it;
                 GRB_LOG_VERBOSE("j = " << j);
 
-                auto t_j(semiring.mult(a, b_j));
-                GRB_LOG_VERBOSE("temp = " << t_j);
-
                 // scan through C_row to find insert/merge point
                 if (advance_and_check_tuple_iterator(c_it, c.end(), j))
                 {
-                    GRB_LOG_VERBOSE("Accumulating");
-                    std::get<1>(*c_it) = semiring.add(std::get<1>(*c_it), t_j);
+                    // ANY keeps the stored value: skip the product entirely
+                    if constexpr (!is_any_semiring_v<SemiringT>)
+                    {
+                        GRB_LOG_VERBOSE("Accumulating");
+                        std::get<1>(*c_it) = semiring.add(std::get<1>(*c_it),
+                                                          semiring.mult(a, b_j));
+                    }
                     ++c_it;
                 }
                 else
                 {
                     GRB_LOG_VERBOSE("Inserting");
                     c_it = c.insert(c_it,
-                                    std::make_tuple(j, static_cast<CScalarT>(t_j)));
+                                    std::make_tuple(j, static_cast<CScalarT>(
+                                                        semiring.mult(a, b_j))));
                     ++c_it;
                 }
             }
             GRB_LOG_FN_END("axpy");
         }
 
+        // *******************************************************************
+        /// c += a_ik*b[:]
+        template<typename CScalarT,
+                 typename SemiringT,
+                 typename AScalarT,
+                 typename BScalarT>
+        void axpy(
+            std::vector<std::tuple<IndexType, CScalarT>>       &c,
+            SemiringT                                           semiring,
+            AScalarT                                            a,
+            std::vector<std::tuple<IndexType, BScalarT>> const &b)
+        {
+            axpy(c, semiring, a, b.begin(), b.end());
+        }
+
         // *******************************************************************
         /// perform the following operation on sparse vectors implemented as
         /// vector<tuple<Index, value>>
@@ -1453,21 +1800,24 @@ namespace grb
 
                 BScalarT  b_j(std::get<1>(b_elt));
 
-                auto t_j(semiring.mult(a, b_j));
-                GRB_LOG_VERBOSE("temp = " << t_j);
-
                 // scan through C_row to find insert/merge point
                 if (advance_and_check_tuple_iterator(c_it, c.end(), j))
                 {
-                    GRB_LOG_VERBOSE("Accumulating");
-                    std::get<1>(*c_it) = semiring.add(std::get<1>(*c_it), t_j);
+                    // ANY keeps the stored value: skip the product entirely
+                    if constexpr (!is_any_semiring_v<SemiringT>)
+                    {
+                        GRB_LOG_VERBOSE("Accumulating");
+                        std::get<1>(*c_it) = semiring.add(std::get<1>(*c_it),
+                                                          semiring.mult(a, b_j));
+                    }
                     ++c_it;
                 }
                 else
                 {
                     GRB_LOG_VERBOSE("Inserting");
                     c_it = c.insert(c_it,
-                                    std::make_tuple(j, static_cast<CScalarT>(t_j)));
+                                    std::make_tuple(j, static_cast<CScalarT>(
+                                                        semiring.mult(a, b_j))));
                     ++c_it;
                 }
             }
@@ -1615,5 +1965,1095 @@ namespace grb
             GRB_LOG_FN_END("masked_merge.v2");
         }
 
+        //**********************************************************************
+        // Mask Pushdown
+        //**********************************************************************
+        // Elementwise kernels that only compute the entries the mask allows.
+        // Entries of T outside the mask never reach the output (write-back
+        // keeps C or deletes there), so restricting T to the mask is exact for
+        // any accumulator and for both replace and merge.
+
+        //**********************************************************************
+        /// ans = vec1 .* vec2 at the indices allowed by the mask row
+        template <typename D1, typename D2, typename D3,
+                  typename MScalarT, typename BinaryOpT>
+        void masked_ewise_and(
+            std::vector<std::tuple<grb::IndexType,D3> >             &ans,
+            std::vector<std::tuple<grb::IndexType,D1> >       const &vec1,
+            std::vector<std::tuple<grb::IndexType,D2> >       const &vec2,
+            std::vector<std::tuple<grb::IndexType,MScalarT> > const &mask_vec,
+            bool                                                     structure_flag,
+            bool                                                     complement_flag,
+            BinaryOpT                                                op)
+        {
+            ans.clear();
+            if (!complement_flag && mask_vec.empty()) return;
+
+            auto v1_it = vec1.begin();
+            auto v2_it = vec2.begin();
+            auto m_it  = mask_vec.begin();
+
+            while ((v1_it != vec1.end()) && (v2_it != vec2.end()))
+            {
+                auto&& [v1_idx, v1_val] = *v1_it;
+                auto&& [v2_idx, v2_val] = *v2_it;
+
+                if (v1_idx == v2_idx)
+                {
+                    if (advance_and_check_mask_iterator(
+                            m_it, mask_vec.end(), structure_flag, v1_idx) !=
+                        complement_flag)
+                    {
+                        ans.emplace_back(v1_idx,
+                                         static_cast<D3>(op(v1_val, v2_val)));
+                    }
+                    ++v1_it;
+                    ++v2_it;
+                }
+                else if (v1_idx < v2_idx)
+                {
+                    ++v1_it;
+                }
+                else
+                {
+                    ++v2_it;
+                }
+            }
+        }
+
+        //**********************************************************************
+        /// ans = vec1 .+ vec2 at the indices allowed by the mask row
+        template <typename D1, typename D2, typename D3,
+                  typename MScalarT, typename BinaryOpT>
+        void masked_ewise_or(
+            std::vector<std::tuple<grb::IndexType,D3> >             &ans,
+            std::vector<std::tuple<grb::IndexType,D1> >       const &vec1,
+            std::vector<std::tuple<grb::IndexType,D2> >       const &vec2,
+            std::vector<std::tuple<grb::IndexType,MScalarT> > const &mask_vec,
+            bool                                                     structure_flag,
+            bool                                                     complement_flag,
+            BinaryOpT                                                op)
+        {
+            ans.clear();
+            if (!complement_flag && mask_vec.empty()) return;
+
+            auto v1_it = vec1.begin();
+            auto v2_it = vec2.begin();
+            auto m_it  = mask_vec.begin();
+
+            while ((v1_it != vec1.end()) || (v2_it != vec2.end()))
+            {
+                bool use1 = ((v1_it != vec1.end()) &&
+                             ((v2_it == vec2.end()) ||
+                              (std::get<0>(*v1_it) <= std::get<0>(*v2_it))));
+                bool use2 = ((v2_it != vec2.end()) &&
+                             ((v1_it == vec1.end()) ||
+                              (std::get<0>(*v2_it) <= std::get<0>(*v1_it))));
+                IndexType idx(use1 ? std::get<0>(*v1_it) : std::get<0>(*v2_it));
+
+                if (advance_and_check_mask_iterator(
+                        m_it, mask_vec.end(), structure_flag, idx) !=
+                    complement_flag)
+                {
+                    if (use1 && use2)
+                    {
+                        ans.emplace_back(idx, static_cast<D3>(
+                                             op(std::get<1>(*v1_it),
+                                                std::get<1>(*v2_it))));
+                    }
+                    else if (use1)
+                    {
+                        ans.emplace_back(idx,
+                                         static_cast<D3>(std::get<1>(*v1_it)));
+                    }
+                    else
+                    {
+                        ans.emplace_back(idx,
+                                         static_cast<D3>(std::get<1>(*v2_it)));
+                    }
+                }
+
+                if (use1) ++v1_it;
+                if (use2) ++v2_it;
+            }
+        }
+
+        //**********************************************************************
+        /// ans = f(vec) at the indices allowed by the mask row
+        template <typename D1, typename D3,
+                  typename MScalarT, typename UnaryFuncT>
+        void masked_transform(
+            std::vector<std::tuple<grb::IndexType,D3> >             &ans,
+            std::vector<std::tuple<grb::IndexType,D1> >       const &vec,
+            std::vector<std::tuple<grb::IndexType,MScalarT> > const &mask_vec,
+            bool                                                     structure_flag,
+            bool                                                     complement_flag,
+            UnaryFuncT                                               f)
+        {
+            ans.clear();
+            if (!complement_flag && mask_vec.empty()) return;
+
+            auto m_it = mask_vec.begin();
+            for (auto&& [idx, val] : vec)
+            {
+                if (advance_and_check_mask_iterator(
+                        m_it, mask_vec.end(), structure_flag, idx) !=
+                    complement_flag)
+                {
+                    ans.emplace_back(idx, static_cast<D3>(f(val)));
+                }
+            }
+        }
+
+        //**********************************************************************
+        // Vector versions: a single pass over the bitmaps of the operands and
+        // the mask, evaluating the operator only where the mask allows.
+        template <typename MaskT, typename MBitmapT, typename MValsT>
+        inline bool mask_allows_1D(MBitmapT const &m_bits,
+                                   MValsT   const &m_vals,
+                                   IndexType       idx)
+        {
+            return ((m_bits[idx] &&
+                     (mask_structure_flag_v<MaskT> ||
+                      static_cast<bool>(m_vals[idx]))) !=
+                    mask_complement_flag_v<MaskT>);
+        }
+
+        /// t = u .* v at the indices allowed by the mask
+        template <typename TScalarT, typename UVectorT, typename VVectorT,
+                  typename MaskT, typename BinaryOpT>
+        void masked_ewise_and_1D(
+            std::vector<std::tuple<grb::IndexType,TScalarT> > &t,
+            UVectorT                                    const &u,
+            VVectorT                                    const &v,
+            MaskT                                       const &mask,
+            BinaryOpT                                          op)
+        {
+            auto const &m(get_mask_vector(mask));
+            auto const &m_bits(m.get_bitmap());
+            auto const &m_vals(m.get_vals());
+            auto const &u_bits(u.get_bitmap());
+            auto const &u_vals(u.get_vals());
+            auto const &v_bits(v.get_bitmap());
+            auto const &v_vals(v.get_vals());
+
+            t.clear();
+            for (IndexType idx = 0; idx < u.size(); ++idx)
+            {
+                if (u_bits[idx] && v_bits[idx] &&
+                    mask_allows_1D<MaskT>(m_bits, m_vals, idx))
+                {
+                    t.emplace_back(idx, static_cast<TScalarT>(
+                                       op(u_vals[idx], v_vals[idx])));
+                }
+            }
+        }
+
+        /// t = u .+ v at the indices allowed by the mask
+        template <typename TScalarT, typename UVectorT, typename VVectorT,
+                  typename MaskT, typename BinaryOpT>
+        void masked_ewise_or_1D(
+            std::vector<std::tuple<grb::IndexType,TScalarT> > &t,
+            UVectorT                                    const &u,
+            VVectorT                                    const &v,
+            MaskT                                       const &mask,
+            BinaryOpT                                          op)
+        {
+            auto const &m(get_mask_vector(mask));
+            auto const &m_bits(m.get_bitmap());
+            auto const &m_vals(m.get_vals());
+            auto const &u_bits(u.get_bitmap());
+            auto const &u_vals(u.get_vals());
+            auto const &v_bits(v.get_bitmap());
+            auto const &v_vals(v.get_vals());
+
+            t.clear();
+            for (IndexType idx = 0; idx < u.size(); ++idx)
+            {
+                if (!(u_bits[idx] || v_bits[idx]) ||
+                    !mask_allows_1D<MaskT>(m_bits, m_vals, idx))
+                {
+                    continue;
+                }
+
+                if (u_bits[idx] && v_bits[idx])
+                {
+                    t.emplace_back(idx, static_cast<TScalarT>(
+                                       op(u_vals[idx], v_vals[idx])));
+                }
+                else if (u_bits[idx])
+                {
+                    t.emplace_back(idx, static_cast<TScalarT>(u_vals[idx]));
+                }
+                else
+                {
+                    t.emplace_back(idx, static_cast<TScalarT>(v_vals[idx]));
+                }
+            }
+        }
+
+        /// t = f(u) at the indices allowed by the mask
+        template <typename TScalarT, typename UVectorT,
+                  typename MaskT, typename UnaryFuncT>
+        void masked_transform_1D(
+            std::vector<std::tuple<grb::IndexType,TScalarT> > &t,
+            UVectorT                                    const &u,
+            MaskT                                       const &mask,
+            UnaryFuncT                                         f)
+        {
+            auto const &m(get_mask_vector(mask));
+            auto const &m_bits(m.get_bitmap());
+            auto const &m_vals(m.get_vals());
+            auto const &u_bits(u.get_bitmap());
+            auto const &u_vals(u.get_vals());
+
+            t.clear();
+            for (IndexType idx = 0; idx < u.size(); ++idx)
+            {
+                if (u_bits[idx] && mask_allows_1D<MaskT>(m_bits, m_vals, idx))
+                {
+                    t.emplace_back(idx, static_cast<TScalarT>(f(u_vals[idx])));
+                }
+            }
+        }
+
+        //**********************************************************************
+        // Kernels specialized for known semiring/type combinations.  These
+        // are selected at compile time by the mxv/vxm/mxm implementations
+        // (see is_logical_bool_semiring_v, is_arithmetic_fp_semiring_v and
+        // is_any_pair_semiring_v).
+        //**********************************************************************
+
+        //**********************************************************************
+        /// Slots for the per-thread scratch buffers used by the kernels.
+        /// Dense accumulators (the T_* slots) are all zero between uses, so
+        /// they only ever need to be resized.
+        enum KernelScratchSlot
+        {
+            SCRATCH_U_STRUCT,
+            SCRATCH_U_VALS,
+            SCRATCH_U_FLAGS,
+            SCRATCH_T_STRUCT,
+            SCRATCH_T_VALS,
+            SCRATCH_T_FLAGS,
+            SCRATCH_TOUCHED,
+            SCRATCH_PACKED_ROW,
+            SCRATCH_ROW_INDICES,
+            SCRATCH_ROW_PRODUCTS
+        };
+
+        /// Per-thread buffer that keeps its capacity from one call to the
+        /// next, so the kernels do not allocate O(N) space on every call.
+        /// On its first use in a new operation a buffer larger than the
+        /// context's scratch_limit is released (an empty buffer keeps the
+        /// all-zero invariant).
+        template <typename T, KernelScratchSlot SlotV>
+        std::vector<T> &scratch_buffer()
+        {
+            static thread_local std::vector<T> buffer;
+            static thread_local uint64_t buffer_epoch(0);
+
+            uint64_t epoch(
+                detail::operation_epoch().load(std::memory_order_relaxed));
+            if (epoch != buffer_epoch)
+            {
+                buffer_epoch = epoch;
+                std::size_t limit(context().scratch_limit);
+                if ((limit > 0) && (buffer.capacity()*sizeof(T) > limit))
+                {
+                    std::vector<T>().swap(buffer);
+                }
+            }
+            return buffer;
+        }
+
+        /// True if a dense accumulator of size n with n_touched touched
+        /// entries is cheaper to read back with a full scan
+        inline bool use_dense_scan(IndexType n_touched, IndexType n)
+        {
+            return (static_cast<double>(n_touched) >
+                    context().dense_threshold*static_cast<double>(n));
+        }
+
+        //**********************************************************************
+        /// Number of set bits in a word
+        inline IndexType popcount_word(uint64_t word)
+        {
+#if defined(__GNUC__)
+            return __builtin_popcountll(word);
+#else
+            IndexType count(0);
+            for (; word != 0UL; word &= (word - 1UL)) ++count;
+            return count;
+#endif
+        }
+
+        /// Index of the lowest set bit of a non-zero word
+        inline IndexType lowest_bit(uint64_t word)
+        {
+#if defined(__GNUC__)
+            return __builtin_ctzll(word);
+#else
+            IndexType b(0);
+            for (; !(word & 1UL); word >>= 1) ++b;
+            return b;
+#endif
+        }
+
+        //**********************************************************************
+        /// Pack the structure and (boolean) values of a bitmap vector into
+        /// 64-bit words.
+        template <typename ScalarT>
+        void pack_bitmap(std::vector<uint64_t>          &struct_words,
+                         std::vector<uint64_t>          &value_words,
+                         std::vector<bool>        const &bitmap,
+                         std::vector<ScalarT>     const &vals)
+        {
+            IndexType num_words((bitmap.size() + BITS_PER_WORD - 1)/BITS_PER_WORD);
+            struct_words.assign(num_words, 0UL);
+            value_words.assign(num_words, 0UL);
+
+            for (IndexType idx = 0; idx < bitmap.size(); ++idx)
+            {
+                if (bitmap[idx])
+                {
+                    uint64_t bit(1UL << (idx % BITS_PER_WORD));
+                    struct_words[idx/BITS_PER_WORD] |= bit;
+                    if (static_cast<bool>(vals[idx]))
+                    {
+                        value_words[idx/BITS_PER_WORD] |= bit;
+                    }
+                }
+            }
+        }
+
+        //**********************************************************************
+        /// Convert packed structure/value words back to a sparse vector and
+        /// clear the words.  Empty words are skipped entirely.
+        inline void unpack_bitmap(
+            std::vector<std::tuple<IndexType, bool>>       &t,
+            std::vector<uint64_t>                          &struct_words,
+            std::vector<uint64_t>                          &value_words)
+        {
+            IndexType nvals(0);
+            for (auto word : struct_words) nvals += popcount_word(word);
+
+            t.clear();
+            t.reserve(nvals);
+            for (IndexType w = 0; w < struct_words.size(); ++w)
+            {
+                for (uint64_t word = struct_words[w]; word != 0UL;
+                     word &= (word - 1UL))
+                {
+                    IndexType b(lowest_bit(word));
+                    t.emplace_back(w*BITS_PER_WORD + b,
+                                   static_cast<bool>((value_words[w] >> b) & 1UL));
+                }
+                struct_words[w] = 0UL;
+                value_words[w] = 0UL;
+            }
+        }
+
+        //**********************************************************************
+        /// A sparse row grouped by 64-bit word: (word index, structure bits,
+        /// value bits) in increasing word order.  Boolean kernels work on
+        /// whole words of this form rather than on single elements.
+        using PackedRowType = std::vector<std::tuple<IndexType, uint64_t, uint64_t>>;
+
+        /// Pack the elements [first, last) of a sparse row
+        template <typename IteratorT>
+        void pack_row(PackedRowType &packed, IteratorT first, IteratorT last)
+        {
+            packed.clear();
+            for (auto it = first; it != last; ++it)
+            {
+                auto&& [j, a_j] = *it;
+                IndexType w(j/BITS_PER_WORD);
+                uint64_t bit(1UL << (j % BITS_PER_WORD));
+                if (packed.empty() || (std::get<0>(packed.back()) != w))
+                {
+                    packed.emplace_back(w, 0UL, 0UL);
+                }
+                std::get<1>(packed.back()) |= bit;
+                if (static_cast<bool>(a_j))
+                {
+                    std::get<2>(packed.back()) |= bit;
+                }
+            }
+        }
+
+        /// Pack every row of a matrix
+        template <typename MatrixT>
+        void pack_rows(std::vector<PackedRowType> &packed, MatrixT const &A)
+        {
+            packed.clear();
+            packed.resize(A.nrows());
+
+#pragma omp parallel for schedule(dynamic, 64)
+            for (IndexType i = 0; i < A.nrows(); ++i)
+            {
+                pack_row(packed[i], A[i].begin(), A[i].end());
+            }
+        }
+
+        //**********************************************************************
+        /// Boolean OR-AND dot product of a packed row with a packed vector:
+        /// one AND per word of the row.
+        inline bool or_and_dot_packed(
+            bool                               &ans,
+            PackedRowType                const &a,
+            std::vector<uint64_t>        const &u_struct,
+            std::vector<uint64_t>        const &u_vals)
+        {
+            uint64_t hit(0UL), val(0UL);
+            for (auto&& [w, a_struct, a_vals] : a)
+            {
+                hit |= (a_struct & u_struct[w]);
+                val |= (a_vals & u_vals[w]);
+                if (val != 0UL) break;  // true is terminal for OR
+            }
+
+            ans = (val != 0UL);
+            return (hit != 0UL);
+        }
+
+        /// Boolean OR-AND dot product of a matrix row with a packed vector.
+        template <typename AScalarT>
+        bool or_and_dot_packed(
+            bool                                               &ans,
+            std::vector<std::tuple<IndexType, AScalarT>> const &A_row,
+            std::vector<uint64_t>                        const &u_struct,
+            std::vector<uint64_t>                        const &u_vals)
+        {
+            auto &a(scratch_buffer<std::tuple<IndexType, uint64_t, uint64_t>,
+                                   SCRATCH_PACKED_ROW>());
+            pack_row(a, A_row.begin(), A_row.end());
+            return or_and_dot_packed(ans, a, u_struct, u_vals);
+        }
+
+        //**********************************************************************
+        /// Boolean OR-AND axpy of a packed row into packed words:
+        /// c |= a AND b, one OR per word of b.
+        inline void or_and_axpy_packed(
+            std::vector<uint64_t>              &c_struct,
+            std::vector<uint64_t>              &c_vals,
+            bool                                a,
+            PackedRowType                const &b)
+        {
+            uint64_t a_mask(a ? ~0UL : 0UL);
+            for (auto&& [w, b_struct, b_vals] : b)
+            {
+                c_struct[w] |= b_struct;
+                c_vals[w]   |= (b_vals & a_mask);
+            }
+        }
+
+        /// Same, recording each word of c that becomes non-empty in touched
+        /// (see unpack_touched_words)
+        inline void or_and_axpy_packed(
+            std::vector<uint64_t>              &c_struct,
+            std::vector<uint64_t>              &c_vals,
+            std::vector<IndexType>             &touched,
+            bool                                a,
+            PackedRowType                const &b)
+        {
+            uint64_t a_mask(a ? ~0UL : 0UL);
+            for (auto&& [w, b_struct, b_vals] : b)
+            {
+                if (c_struct[w] == 0UL) touched.push_back(w);
+                c_struct[w] |= b_struct;
+                c_vals[w]   |= (b_vals & a_mask);
+            }
+        }
+
+        /// Boolean OR-AND axpy into packed words: c |= a AND b[first:last]
+        template <typename BIteratorT>
+        void or_and_axpy_packed(
+            std::vector<uint64_t>              &c_struct,
+            std::vector<uint64_t>              &c_vals,
+            bool                                a,
+            BIteratorT                          first,
+            BIteratorT                          last)
+        {
+            auto &b(scratch_buffer<std::tuple<IndexType, uint64_t, uint64_t>,
+                                   SCRATCH_PACKED_ROW>());
+            pack_row(b, first, last);
+            or_and_axpy_packed(c_struct, c_vals, a, b);
+        }
+
+        //**********************************************************************
+        /// Convert the touched words of a packed accumulator to a sparse
+        /// vector and clear them (O(nvals), independent of the row length).
+        inline void unpack_touched_words(
+            std::vector<std::tuple<IndexType, bool>>       &t,
+            std::vector<uint64_t>                          &struct_words,
+            std::vector<uint64_t>                          &value_words,
+            std::vector<IndexType>                         &touched)
+        {
+            if (use_dense_scan(touched.size(), struct_words.size()))
+            {
+                touched.clear();
+                unpack_bitmap(t, struct_words, value_words);
+                return;
+            }
+
+            std::sort(touched.begin(), touched.end());
+
+            IndexType nvals(0);
+            for (auto w : touched) nvals += popcount_word(struct_words[w]);
+
+            t.clear();
+            t.reserve(nvals);
+            for (auto w : touched)
+            {
+                for (uint64_t word = struct_words[w]; word != 0UL;
+                     word &= (word - 1UL))
+                {
+                    IndexType b(lowest_bit(word));
+                    t.emplace_back(w*BITS_PER_WORD + b,
+                                   static_cast<bool>((value_words[w] >> b) & 1UL));
+                }
+                struct_words[w] = 0UL;
+                value_words[w] = 0UL;
+            }
+            touched.clear();
+        }
+
+        //**********************************************************************
+        /// Byte-wide copy of a bitmap so that it can be used in branch-free
+        /// (vectorizable) loops.
+        inline void unpack_flags(std::vector<uint8_t>       &flags,
+                                 std::vector<bool>    const &bitmap)
+        {
+            flags.assign(bitmap.begin(), bitmap.end());
+        }
+
+        //**********************************************************************
+        /// Split the elements [first, last) of a sparse row into separate
+        /// index and value arrays (structure of arrays) so that the
+        /// arithmetic on them is a plain loop over contiguous values.
+        template <typename D3, typename IteratorT>
+        void split_row(std::vector<IndexType> &indices,
+                       std::vector<D3>        &values,
+                       IteratorT               first,
+                       IteratorT               last)
+        {
+            indices.clear();
+            values.clear();
+            for (auto it = first; it != last; ++it)
+            {
+                indices.push_back(std::get<0>(*it));
+                values.push_back(static_cast<D3>(std::get<1>(*it)));
+            }
+        }
+
+        //**********************************************************************
+        /// PLUS-TIMES dot product of a matrix row with a dense (gathered)
+        /// vector.  The products are formed in one vectorizable pass over
+        /// the split row; the sum is then seeded from the first stored
+        /// product (as the generic dot product does) and unstored elements
+        /// of u add -0.0, which leaves every value, including -0.0,
+        /// unchanged.
+        template <typename D3, typename AScalarT, typename UScalarT>
+        bool plus_times_dot_dense(
+            D3                                                 &ans,
+            std::vector<std::tuple<IndexType, AScalarT>> const &A_row,
+            std::vector<uint8_t>                         const &u_flags,
+            std::vector<UScalarT>                        const &u_vals)
+        {
+            auto &indices(scratch_buffer<IndexType, SCRATCH_ROW_INDICES>());
+            auto &prods(scratch_buffer<D3, SCRATCH_ROW_PRODUCTS>());
+            split_row(indices, prods, A_row.begin(), A_row.end());
+
+            IndexType const n(indices.size());
+            for (IndexType k = 0; k < n; ++k)
+            {
+                prods[k] *= static_cast<D3>(u_vals[indices[k]]);
+            }
+
+            IndexType k(0);
+            while ((k < n) && !u_flags[indices[k]]) ++k;
+            if (k == n)
+            {
+                return false;
+            }
+
+            D3 sum(prods[k]);
+            for (++k; k < n; ++k)
+            {
+                sum += (u_flags[indices[k]] ? prods[k] : static_cast<D3>(-0.0));
+            }
+
+            ans = sum;
+            return true;
+        }
+
+        //**********************************************************************
+        /// PLUS-TIMES axpy into a dense accumulator: c += a*b[first:last].
+        /// The first product stored at an index seeds it.
+        template <typename D3, typename BIteratorT>
+        void plus_times_axpy_dense(
+            std::vector<D3>                    &c_vals,
+            std::vector<uint8_t>               &c_flags,
+            D3                                  a,
+            BIteratorT                          first,
+            BIteratorT                          last)
+        {
+            auto &indices(scratch_buffer<IndexType, SCRATCH_ROW_INDICES>());
+            auto &prods(scratch_buffer<D3, SCRATCH_ROW_PRODUCTS>());
+            split_row(indices, prods, first, last);
+
+            IndexType const n(indices.size());
+            for (IndexType k = 0; k < n; ++k)
+            {
+                prods[k] *= a;
+            }
+
+            for (IndexType k = 0; k < n; ++k)
+            {
+                IndexType j(indices[k]);
+                c_vals[j] = (c_flags[j] ? c_vals[j] + prods[k] : prods[k]);
+                c_flags[j] = 1;
+            }
+        }
+
+        /// Same, recording each index of c that becomes stored in touched
+        /// (see dense_to_tuples).  Used for the short rows of mxm, where
+        /// splitting the row first does not pay off.
+        template <typename D3, typename BIteratorT>
+        void plus_times_axpy_dense(
+            std::vector<D3>                    &c_vals,
+            std::vector<uint8_t>               &c_flags,
+            std::vector<IndexType>             &touched,
+            D3                                  a,
+            BIteratorT                          first,
+            BIteratorT                          last)
+        {
+            for (auto it = first; it != last; ++it)
+            {
+                auto&& [j, b_j] = *it;
+                D3 prod(a * static_cast<D3>(b_j));
+                if (c_flags[j])
+                {
+                    c_vals[j] += prod;
+                }
+                else
+                {
+                    c_vals[j] = prod;
+                    c_flags[j] = 1;
+                    touched.push_back(j);
+                }
+            }
+        }
+
+        //**********************************************************************
+        /// Convert a dense accumulator back to a sparse vector and clear its
+        /// flags.
+        template <typename D3>
+        void dense_to_tuples(std::vector<std::tuple<IndexType, D3>>       &t,
+                             std::vector<D3>                        const &c_vals,
+                             std::vector<uint8_t>                         &c_flags)
+        {
+            t.clear();
+            for (IndexType idx = 0; idx < c_flags.size(); ++idx)
+            {
+                if (c_flags[idx])
+                {
+                    t.emplace_back(idx, c_vals[idx]);
+                    c_flags[idx] = 0;
+                }
+            }
+        }
+
+        /// Same, visiting only the touched indices (O(nvals log nvals),
+        /// independent of the length of the accumulator) unless enough of
+        /// the accumulator was touched that a full scan is cheaper
+        template <typename D3>
+        void dense_to_tuples(std::vector<std::tuple<IndexType, D3>>       &t,
+                             std::vector<D3>                        const &c_vals,
+                             std::vector<uint8_t>                         &c_flags,
+                             std::vector<IndexType>                       &touched)
+        {
+            if (use_dense_scan(touched.size(), c_flags.size()))
+            {
+                touched.clear();
+                dense_to_tuples(t, c_vals, c_flags);
+                return;
+            }
+
+            std::sort(touched.begin(), touched.end());
+
+            t.clear();
+            t.reserve(touched.size());
+            for (auto idx : touched)
+            {
+                t.emplace_back(idx, c_vals[idx]);
+                c_flags[idx] = 0;
+            }
+            touched.clear();
+        }
+
+        //**********************************************************************
+        /// Pack only the structure of a bitmap vector into 64-bit words
+        /// (used by the structure-only ANY-PAIR kernels; values never read).
+        inline void pack_structure(std::vector<uint64_t>       &struct_words,
+                                   std::vector<bool>     const &bitmap)
+        {
+            struct_words.assign(
+                (bitmap.size() + BITS_PER_WORD - 1)/BITS_PER_WORD, 0UL);
+
+            for (IndexType idx = 0; idx < bitmap.size(); ++idx)
+            {
+                if (bitmap[idx])
+                {
+                    struct_words[idx/BITS_PER_WORD] |=
+                        (1UL << (idx % BITS_PER_WORD));
+                }
+            }
+        }
+
+        //**********************************************************************
+        /// Convert packed structure words to a sparse vector holding 'val'
+        /// and clear the words.
+        template <typename TScalarT>
+        void unpack_structure(std::vector<std::tuple<IndexType, TScalarT>> &t,
+                              std::vector<uint64_t>                        &struct_words,
+                              TScalarT                                      val)
+        {
+            IndexType nvals(0);
+            for (auto word : struct_words) nvals += popcount_word(word);
+
+            t.clear();
+            t.reserve(nvals);
+            for (IndexType w = 0; w < struct_words.size(); ++w)
+            {
+                for (uint64_t word = struct_words[w]; word != 0UL;
+                     word &= (word - 1UL))
+                {
+                    t.emplace_back(w*BITS_PER_WORD + lowest_bit(word), val);
+                }
+                struct_words[w] = 0UL;
+            }
+        }
+
+        //**********************************************************************
+        /// ANY-PAIR "dot product": does the row's structure intersect u's?
+        /// Stops at the first hit and never reads the row's values.
+        template <typename AScalarT>
+        bool structure_dot_packed(
+            std::vector<std::tuple<IndexType, AScalarT>> const &A_row,
+            std::vector<uint64_t>                        const &u_struct)
+        {
+            for (auto const &elt : A_row)
+            {
+                IndexType j(std::get<0>(elt));
+                if (u_struct[j/BITS_PER_WORD] & (1UL << (j % BITS_PER_WORD)))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //**********************************************************************
+        /// ANY-PAIR axpy into packed words: struct(c) |= struct(b[first:last])
+        template <typename BIteratorT>
+        void structure_axpy_packed(
+            std::vector<uint64_t>                              &c_struct,
+            BIteratorT                                          first,
+            BIteratorT                                          last)
+        {
+            for (auto it = first; it != last; ++it)
+            {
+                IndexType j(std::get<0>(*it));
+                c_struct[j/BITS_PER_WORD] |= (1UL << (j % BITS_PER_WORD));
+            }
+        }
+
+        //**********************************************************************
+        /// row_product with the sorted-merge axpy (any semiring)
+        template <typename TScalarT,
+                  typename SemiringT,
+                  typename ARowT,
+                  typename BMatrixT>
+        void row_product_merge(
+            std::vector<std::tuple<IndexType, TScalarT>> &t_row,
+            SemiringT                                     op,
+            ARowT                                  const &A_i,
+            BMatrixT                               const &B)
+        {
+            for (auto&& [k, a_ik] : A_i)
+            {
+                if (!B[k].empty())
+                {
+                    // T[i] += (a_ik*B[k])  // must reduce in D3
+                    axpy(t_row, op, a_ik, B[k]);
+                }
+            }
+        }
+
+        /// One row of a Gustavson product: t_row = A_i +.* B, where A_i is
+        /// a row of A and B is stored by rows.  Boolean OR-AND accumulates
+        /// whole words of the packed rows of B (B_packed, from pack_rows;
+        /// unused otherwise) and floating point PLUS-TIMES accumulates into
+        /// a dense row; both only revisit the touched part of their
+        /// accumulator.  Other semirings (or any semiring when the context
+        /// asks for MXM_KERNEL_PUSH) use the sorted-merge axpy.
+        template <typename TScalarT,
+                  typename SemiringT,
+                  typename ARowT,
+                  typename BMatrixT>
+        void row_product(std::vector<std::tuple<IndexType, TScalarT>> &t_row,
+                         SemiringT                                     op,
+                         ARowT                                  const &A_i,
+                         BMatrixT                               const &B,
+                         std::vector<PackedRowType>             const &B_packed)
+        {
+            t_row.clear();
+
+            // MXM_KERNEL_PUSH: always use the sorted-merge accumulator
+            bool const dense_accum(context().mxm_kernel != MXM_KERNEL_PUSH);
+
+            if constexpr (is_logical_bool_semiring_v<SemiringT>)
+            {
+                if (!dense_accum)
+                {
+                    row_product_merge(t_row, op, A_i, B);
+                    return;
+                }
+                auto &t_struct(scratch_buffer<uint64_t, SCRATCH_T_STRUCT>());
+                auto &t_vals(scratch_buffer<uint64_t, SCRATCH_T_VALS>());
+                auto &touched(scratch_buffer<IndexType, SCRATCH_TOUCHED>());
+                IndexType nwords((B.ncols() + BITS_PER_WORD - 1)/BITS_PER_WORD);
+                t_struct.resize(nwords, 0UL);
+                t_vals.resize(nwords, 0UL);
+
+                for (auto&& [k, a_ik] : A_i)
+                {
+                    or_and_axpy_packed(t_struct, t_vals, touched,
+                                       static_cast<bool>(a_ik), B_packed[k]);
+                }
+                unpack_touched_words(t_row, t_struct, t_vals, touched);
+            }
+            else if constexpr (is_arithmetic_fp_semiring_v<SemiringT>)
+            {
+                if (!dense_accum)
+                {
+                    row_product_merge(t_row, op, A_i, B);
+                    return;
+                }
+                auto &t_vals(scratch_buffer<TScalarT, SCRATCH_T_VALS>());
+                auto &t_flags(scratch_buffer<uint8_t, SCRATCH_T_FLAGS>());
+                auto &touched(scratch_buffer<IndexType, SCRATCH_TOUCHED>());
+                t_vals.resize(B.ncols());
+                t_flags.resize(B.ncols(), 0);
+
+                for (auto&& [k, a_ik] : A_i)
+                {
+                    plus_times_axpy_dense(t_vals, t_flags, touched,
+                                          static_cast<TScalarT>(a_ik),
+                                          B[k].begin(), B[k].end());
+                }
+                dense_to_tuples(t_row, t_vals, t_flags, touched);
+            }
+            else
+            {
+                row_product_merge(t_row, op, A_i, B);
+            }
+        }
+
+        /// Packed rows of B for row_product (only built for OR-AND)
+        template <typename SemiringT, typename BMatrixT>
+        void prepare_row_product(std::vector<PackedRowType> &B_packed,
+                                 BMatrixT             const &B)
+        {
+            if constexpr (is_logical_bool_semiring_v<SemiringT>)
+            {
+                if (context().mxm_kernel != MXM_KERNEL_PUSH)
+                {
+                    pack_rows(B_packed, B);
+                }
+            }
+        }
+
+        //**********************************************************************
+        // Flop-balanced scheduling of row-wise products
+        //**********************************************************************
+
+        /// A [first, last) iterator pair usable in a range-for (e.g. part of
+        /// a row passed to row_product).
+        template <typename IteratorT>
+        struct IteratorRange
+        {
+            IteratorT first, last;
+            IteratorT begin() const { return first; }
+            IteratorT end()   const { return last; }
+        };
+
+        /// Row schedule for a parallel Gustavson product A*B.  The work of
+        /// row i is estimated as 1 + sum(B[k].size()) over the stored A(i,k).
+        /// Rows are grouped into contiguous blocks of about equal work, and
+        /// rows with more than a thread's share of the total ("hub" rows of
+        /// power-law graphs) are flagged so they can be split across
+        /// threads instead.
+        struct ProductRowSchedule
+        {
+            std::vector<IndexType> block_starts;  ///< nblocks + 1 row bounds
+            std::vector<uint8_t>   is_hub;        ///< empty if there are none
+            std::vector<IndexType> hub_rows;
+        };
+
+        template <typename AMatrixT, typename BMatrixT>
+        void schedule_product_rows(ProductRowSchedule       &sched,
+                                   AMatrixT           const &A,
+                                   BMatrixT           const &B,
+                                   bool                      split_hubs)
+        {
+            IndexType nrows(A.nrows());
+            int nthreads(num_threads());
+            sched.block_starts.clear();
+            sched.is_hub.clear();
+            sched.hub_rows.clear();
+
+            // One thread: one block and no estimate needed
+            if (nthreads == 1)
+            {
+                sched.block_starts = {0, nrows};
+                return;
+            }
+
+            std::vector<IndexType> flops(nrows);
+            IndexType total(0);
+            for (IndexType i = 0; i < nrows; ++i)
+            {
+                IndexType row_flops(1);
+                for (auto const &elt : A[i])
+                {
+                    row_flops += B[std::get<0>(elt)].size();
+                }
+                flops[i] = row_flops;
+                total += row_flops;
+            }
+
+            if (split_hubs)
+            {
+                IndexType fair_share(total/nthreads);
+                for (IndexType i = 0; i < nrows; ++i)
+                {
+                    if ((flops[i] > fair_share) && (A[i].size() > 1))
+                    {
+                        if (sched.is_hub.empty()) sched.is_hub.resize(nrows, 0);
+                        sched.is_hub[i] = 1;
+                        sched.hub_rows.push_back(i);
+                        total -= flops[i];
+                        flops[i] = 0;
+                    }
+                }
+            }
+
+            // Several blocks per thread so idle threads can take over the
+            // remaining ranges (dynamic schedule)
+            IndexType budget(std::max<IndexType>(1, total/(8*nthreads)));
+            IndexType work(0);
+            sched.block_starts.push_back(0);
+            for (IndexType i = 0; i < nrows; ++i)
+            {
+                work += flops[i];
+                if (work >= budget)
+                {
+                    sched.block_starts.push_back(i + 1);
+                    work = 0;
+                }
+            }
+            if (sched.block_starts.back() != nrows)
+            {
+                sched.block_starts.push_back(nrows);
+            }
+        }
+
+        /// Call row_fn(i) for every non-hub row of the schedule.  Blocks are
+        /// handed out dynamically; each thread works on its own copy of
+        /// row_fn (so a mutable lambda can carry per-thread row buffers).
+        template <typename RowFnT>
+        void parallel_product_rows(ProductRowSchedule const &sched,
+                                   RowFnT                    row_fn)
+        {
+            IndexType nblocks(sched.block_starts.size() - 1);
+#pragma omp parallel
+            {
+                RowFnT block_fn(row_fn);
+#pragma omp for schedule(dynamic, 1)
+                for (IndexType b = 0; b < nblocks; ++b)
+                {
+                    for (IndexType i = sched.block_starts[b];
+                         i < sched.block_starts[b + 1]; ++i)
+                    {
+                        if (sched.is_hub.empty() || !sched.is_hub[i])
+                        {
+                            block_fn(i);
+                        }
+                    }
+                }
+            }
+        }
+
+        /// row_product for a single heavy row, split across threads: A_i is
+        /// cut into one piece of about equal work per thread, each piece is
+        /// multiplied separately and the partial rows are added together in
+        /// order (so the additions per element keep their sequential order).
+        template <typename TScalarT,
+                  typename SemiringT,
+                  typename ARowT,
+                  typename BMatrixT>
+        void split_row_product(
+            std::vector<std::tuple<IndexType, TScalarT>> &t_row,
+            SemiringT                                     op,
+            ARowT                                  const &A_i,
+            BMatrixT                               const &B,
+            std::vector<PackedRowType>             const &B_packed)
+        {
+            IndexType nparts(std::max<IndexType>(
+                1, std::min<IndexType>(num_threads(), A_i.size())));
+
+            IndexType total(0);
+            for (auto const &elt : A_i) total += 1 + B[std::get<0>(elt)].size();
+
+            std::vector<IndexType> cuts(1, 0);
+            IndexType work(0), pos(0);
+            for (auto const &elt : A_i)
+            {
+                work += 1 + B[std::get<0>(elt)].size();
+                ++pos;
+                if ((cuts.size() < nparts) &&
+                    (work >= (total*cuts.size())/nparts))
+                {
+                    cuts.push_back(pos);
+                }
+            }
+            cuts.push_back(A_i.size());
+            nparts = cuts.size() - 1;
+
+            std::vector<std::vector<std::tuple<IndexType, TScalarT>>>
+                parts(nparts);
+#pragma omp parallel for schedule(static, 1)
+            for (IndexType p = 0; p < nparts; ++p)
+            {
+                IteratorRange<typename ARowT::const_iterator> piece{
+                    A_i.begin() + cuts[p], A_i.begin() + cuts[p + 1]};
+                row_product(parts[p], op, piece, B, B_packed);
+            }
+
+            auto add = [&op](auto const &a, auto const &b)
+                { return op.add(a, b); };
+            std::vector<std::tuple<IndexType, TScalarT>> sum;
+            t_row.swap(parts[0]);
+            for (IndexType p = 1; p < nparts; ++p)
+            {
+                if (parts[p].empty()) continue;
+                ewise_or(sum, t_row, parts[p], add);
+                t_row.swap(sum);
+            }
+        }
+
     } // backend
 } // grb
@@ -76,7 +76,6 @@ namespace grb
 
             using AScalarType = typename AMatrixT::ScalarType;
             using BScalarType = typename BMatrixT::ScalarType;
-            using CScalarType = typename CMatrixT::ScalarType;
 
             // =================================================================
             // Do the basic product work with the binaryop.
@@ -87,6 +86,7 @@ namespace grb
             if ((A.nvals() > 0) && (B.nvals() > 0))
             {
                 // create a row of the result at a time
+#pragma omp parallel for schedule(dynamic, 16)
                 for (IndexType row_idxA = 0; row_idxA < nrow_A; ++row_idxA)
                 {
                     if (A[row_idxA].empty()) continue;
@@ -107,29 +107,15 @@ namespace grb
                             }
                         }
                     }
-                    T.recomputeNvals();
                 }
+                T.recomputeNvals();
             }
 
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(nrow_C, ncol_C);
-
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, M, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, M, accum, outp);
 
         }
 
@@ -163,7 +149,6 @@ namespace grb
 
             using AScalarType = typename AMatrixT::ScalarType;
             using BScalarType = typename BMatrixT::ScalarType;
-            using CScalarType = typename CMatrixT::ScalarType;
 
             // =================================================================
             // Do the basic product work with the binaryop.
@@ -173,48 +158,40 @@ namespace grb
 
             if ((A.nvals() > 0) && (B.nvals() > 0))
             {
-                // create a row of the result at a time
-                for (IndexType row_idxA = 0; row_idxA < nrow_A; ++row_idxA)
+                // Rows of T come from the columns of A: transpose A once so
+                // that each row of the result is created by one thread
+                LilSparseMatrix<AScalarType> AT_rows(A.ncols(), nrow_A);
+                parallel_transpose(AT_rows, A);
+                IndexType nrow_AT(AT_rows.nrows());
+
+#pragma omp parallel for schedule(dynamic, 16)
+                for (IndexType row_idxAT = 0; row_idxAT < nrow_AT; ++row_idxAT)
                 {
-                    if (A[row_idxA].empty()) continue;
+                    if (AT_rows[row_idxAT].empty()) continue;
 
                     for (IndexType row_idxB = 0; row_idxB < nrow_B; ++row_idxB)
                     {
                         if (B[row_idxB].empty()) continue;
 
-                        for (auto&& [col_idxA, val_A] : A[row_idxA])
-                        {
-                            IndexType T_row_idx(col_idxA*nrow_B + row_idxB);
+                        IndexType T_row_idx(row_idxAT*nrow_B + row_idxB);
 
+                        for (auto&& [col_idxAT, val_A] : AT_rows[row_idxAT])
+                        {
                             for (auto&& [col_idxB, val_B] : B[row_idxB])
                             {
                                 TScalarType T_val(op(val_A, val_B));
                                 T[T_row_idx].emplace_back(
-                                    (row_idxA*ncol_B + col_idxB), T_val);
+                                    (col_idxAT*ncol_B + col_idxB), T_val);
                             }
                         }
                     }
-                    T.recomputeNvals();
                 }
+                T.recomputeNvals();
             }
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(nrow_C, ncol_C);
-
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, M, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, M, accum, outp);
 
         }
 
@@ -248,7 +225,6 @@ namespace grb
 
             using AScalarType = typename AMatrixT::ScalarType;
             using BScalarType = typename BMatrixT::ScalarType;
-            using CScalarType = typename CMatrixT::ScalarType;
 
             // =================================================================
             // Do the basic product work with the binaryop.
@@ -259,6 +235,7 @@ namespace grb
             if ((A.nvals() > 0) && (B.nvals() > 0))
             {
                 // create a row of the result at a time
+#pragma omp parallel for schedule(dynamic, 16)
                 for (IndexType row_idxA = 0; row_idxA < nrow_A; ++row_idxA)
                 {
                     if (A[row_idxA].empty()) continue;
@@ -279,27 +256,13 @@ namespace grb
                             }
                         }
                     }
-                    T.recomputeNvals();
                 }
+                T.recomputeNvals();
             }
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(nrow_C, ncol_C);
-
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, M, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, M, accum, outp);
 
         }
 
@@ -334,7 +297,6 @@ namespace grb
 
             using AScalarType = typename AMatrixT::ScalarType;
             using BScalarType = typename BMatrixT::ScalarType;
-            using CScalarType = typename CMatrixT::ScalarType;
 
             // =================================================================
             // Do the basic product work with the binaryop.
@@ -344,47 +306,40 @@ namespace grb
 
             if ((A.nvals() > 0) && (B.nvals() > 0))
             {
-                // create a row of the result at a time
-                for (IndexType row_idxA = 0; row_idxA < nrow_A; ++row_idxA)
+                // Rows of T come from the columns of A: transpose A once so
+                // that each row of the result is created by one thread
+                LilSparseMatrix<AScalarType> AT_rows(A.ncols(), nrow_A);
+                parallel_transpose(AT_rows, A);
+                IndexType nrow_AT(AT_rows.nrows());
+
+#pragma omp parallel for schedule(dynamic, 16)
+                for (IndexType row_idxAT = 0; row_idxAT < nrow_AT; ++row_idxAT)
                 {
-                    if (A[row_idxA].empty()) continue;
+                    if (AT_rows[row_idxAT].empty()) continue;
 
-                    for (IndexType row_idxB = 0; row_idxB < nrow_B; ++row_idxB)
+                    for (auto&& [col_idxAT, val_A] : AT_rows[row_idxAT])
                     {
-                        if (B[row_idxB].empty()) continue;
-                        IndexType T_col_idx(row_idxA*nrow_B + row_idxB);
-
-                        for (auto&& [col_idxA, val_A] : A[row_idxA])
+                        for (IndexType row_idxB = 0; row_idxB < nrow_B; ++row_idxB)
                         {
+                            if (B[row_idxB].empty()) continue;
+
+                            IndexType T_col_idx(col_idxAT*nrow_B + row_idxB);
+
                             for (auto&& [col_idxB, val_B] : B[row_idxB])
                             {
                                 TScalarType T_val(op(val_A, val_B));
-                                IndexType T_row_idx(col_idxA*ncol_B + col_idxB);
+                                IndexType T_row_idx(row_idxAT*ncol_B + col_idxB);
                                 T[T_row_idx].emplace_back(T_col_idx, T_val);
                             }
                         }
                     }
-                    T.recomputeNvals();
                 }
+                T.recomputeNvals();
             }
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(nrow_C, ncol_C);
-
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, M, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, M, accum, outp);
 
         }
 
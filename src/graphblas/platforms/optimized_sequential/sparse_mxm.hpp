@@ -57,6 +57,18 @@ namespace grb
         //**********************************************************************
         //**********************************************************************
 
+        //**********************************************************************
+        /// B' as a new matrix (for the MXM_KERNEL_DOT hint, which computes a
+        /// masked A*B as the dot products of A*(B')')
+        template<class BMat>
+        LilSparseMatrix<typename BMat::ScalarType> transposed_copy(
+            BMat const &B)
+        {
+            LilSparseMatrix<typename BMat::ScalarType> BT(B.ncols(), B.nrows());
+            parallel_transpose(BT, B);
+            return BT;
+        }
+
         //**********************************************************************
         /// Dispatch for 4.3.1 mxm: A * B
         //**********************************************************************
@@ -97,6 +109,12 @@ namespace grb
         {
             GRB_LOG_VERBOSE("C<M" << ((outp == REPLACE) ? ",z>" : ">")
                             << " := (A*B)");
+            if (context().mxm_kernel == MXM_KERNEL_DOT)
+            {
+                sparse_mxm_Mask_NoAccum_ABT(C, M, false, op, A,
+                                            transposed_copy(B), outp);
+                return;
+            }
             sparse_mxm_Mask_NoAccum_AB(C, M, false, op, A, B, outp);
         }
 
@@ -111,6 +129,12 @@ namespace grb
         {
             GRB_LOG_VERBOSE("C<M" << ((outp == REPLACE) ? ",z>" : ">")
                             << " := (C + A*B)");
+            if (context().mxm_kernel == MXM_KERNEL_DOT)
+            {
+                sparse_mxm_Mask_Accum_ABT(C, M, false, accum, op, A,
+                                          transposed_copy(B), outp);
+                return;
+            }
             sparse_mxm_Mask_Accum_AB(C, M, false, accum, op, A, B, outp);
         }
 
@@ -125,6 +149,12 @@ namespace grb
         {
             GRB_LOG_VERBOSE("C<struct(M)" << ((outp == REPLACE) ? ",z>" : ">")
                             << " := (A*B)");
+            if (context().mxm_kernel == MXM_KERNEL_DOT)
+            {
+                sparse_mxm_Mask_NoAccum_ABT(C, M_view.m_mat, true, op, A,
+                                            transposed_copy(B), outp);
+                return;
+            }
             sparse_mxm_Mask_NoAccum_AB(C, M_view.m_mat, true, op, A, B, outp);
         }
 
@@ -139,6 +169,12 @@ namespace grb
         {
             GRB_LOG_VERBOSE("C<struct(M)" << ((outp == REPLACE) ? ",z>" : ">")
                             << " := (C + A*B)");
+            if (context().mxm_kernel == MXM_KERNEL_DOT)
+            {
+                sparse_mxm_Mask_Accum_ABT(C, M_view.m_mat, true, accum, op, A,
+                                          transposed_copy(B), outp);
+                return;
+            }
             sparse_mxm_Mask_Accum_AB(C, M_view.m_mat, true, accum, op, A, B, outp);
         }
 
@@ -67,23 +67,28 @@ namespace grb
             using TScalarType = typename SemiringT::result_type;
             typename LilSparseMatrix<TScalarType>::RowType T_row;
 
-            for (IndexType i = 0; i < A.nrows(); ++i)
-            {
-                T_row.clear();
-                for (auto const &Ai_elt : A[i])
-                {
-                    IndexType    k(std::get<0>(Ai_elt));
-                    AScalarT  a_ik(std::get<1>(Ai_elt));
+            std::vector<PackedRowType> B_packed;
+            prepare_row_product<SemiringT>(B_packed, B);
 
-                    if (B[k].empty()) continue;
+            ProductRowSchedule sched;
+            schedule_product_rows(sched, A, B, true);
 
-                    // T[i] += (a_ik*B[k])  // must reduce in D3
-                    axpy(T_row, semiring, a_ik, B[k]);
-                }
-
-                // C[i] = T[i]
-                C.setRow(i, T_row);  // set even if it is empty.
+            for (IndexType i : sched.hub_rows)
+            {
+                split_row_product(T_row, semiring, A[i], B, B_packed);
+                C.setRow(i, T_row);
             }
+
+            parallel_product_rows(
+                sched,
+                [&C, &semiring, &A, &B, &B_packed, T_row](IndexType i) mutable
+                {
+                    // T[i] = A[i] +.* B
+                    row_product(T_row, semiring, A[i], B, B_packed);
+
+                    // C[i] = T[i]
+                    C.setRow(i, T_row);  // set even if it is empty.
+                });
         }
 
         //**********************************************************************
@@ -103,26 +108,32 @@ namespace grb
             using TScalarType = typename SemiringT::result_type;
             typename LilSparseMatrix<TScalarType>::RowType T_row;
 
-            for (IndexType i = 0; i < A.nrows(); ++i)
-            {
-                T_row.clear();
-                for (auto const &Ai_elt : A[i])
-                {
-                    IndexType    k(std::get<0>(Ai_elt));
-                    AScalarT  a_ik(std::get<1>(Ai_elt));
+            std::vector<PackedRowType> B_packed;
+            prepare_row_product<SemiringT>(B_packed, B);
 
-                    if (B[k].empty()) continue;
+            ProductRowSchedule sched;
+            schedule_product_rows(sched, A, B, true);
 
-                    // T[i] += (a_ik*B[k])  // must reduce in D3
-                    axpy(T_row, semiring, a_ik, B[k]);
-                }
+            for (IndexType i : sched.hub_rows)
+            {
+                split_row_product(T_row, semiring, A[i], B, B_packed);
+                if (!T_row.empty()) C.mergeRow(i, T_row, accum);
+            }
 
-                if (!T_row.empty())
+            parallel_product_rows(
+                sched,
+                [&C, &accum, &semiring, &A, &B, &B_packed, T_row](IndexType i)
+                mutable
                 {
-                    // C[i] = C[i] + T[i]
-                    C.mergeRow(i, T_row, accum);
-                }
-            }
+                    // T[i] = A[i] +.* B
+                    row_product(T_row, semiring, A[i], B, B_packed);
+
+                    if (!T_row.empty())
+                    {
+                        // C[i] = C[i] + T[i]
+                        C.mergeRow(i, T_row, accum);
+                    }
+                });
         }
 
         //**********************************************************************
@@ -145,43 +156,48 @@ namespace grb
             typename LilSparseMatrix<TScalarType>::RowType T_row;
             typename LilSparseMatrix<CScalarT>::RowType C_row;
 
-            for (IndexType i = 0; i < A.nrows(); ++i) // compute row i of answer
-            {
-                bool const complement_flag = false;
-                T_row.clear();
+            ProductRowSchedule sched;
+            schedule_product_rows(sched, A, B, false);
 
-                // don't compute row if mask row is empty
-                if (!M[i].empty())
+            parallel_product_rows(
+                sched,
+                [&, T_row, C_row](IndexType i) mutable
                 {
-                    for (auto const &Ai_elt : A[i])
-                    {
-                        IndexType    k(std::get<0>(Ai_elt));
-                        AScalarT  a_ik(std::get<1>(Ai_elt));
-
-                        if (B[k].empty()) continue;
+                    bool const complement_flag = false;
+                    T_row.clear();
 
-                        // T[i] += M[i] .* a_ik*B[k]
-                        masked_axpy(T_row,
-                                    M[i], structure_flag, complement_flag,
-                                    semiring, a_ik, B[k]);
+                    // don't compute row if mask row is empty
+                    if (!M[i].empty())
+                    {
+                        for (auto const &Ai_elt : A[i])
+                        {
+                            IndexType    k(std::get<0>(Ai_elt));
+                            AScalarT  a_ik(std::get<1>(Ai_elt));
+
+                            if (B[k].empty()) continue;
+
+                            // T[i] += M[i] .* a_ik*B[k]
+                            masked_axpy(T_row,
+                                        M[i], structure_flag, complement_flag,
+                                        semiring, a_ik, B[k]);
+                        }
                     }
-                }
 
-                if (outp == REPLACE)
-                {
-                    // C[i] = T[i], z = "replace"
-                    C.setRow(i, T_row);  // set even if it is empty.
-                }
-                else
-                {
-                    // C[i] = [!M .* C]  U  T[i], z = "merge"
-                    C_row.clear();
-                    masked_merge(C_row,
-                                 M[i], structure_flag, complement_flag,
-                                 C[i], T_row);
-                    C.setRow(i, C_row);
-                }
-            }
+                    if (outp == REPLACE)
+                    {
+                        // C[i] = T[i], z = "replace"
+                        C.setRow(i, T_row);  // set even if it is empty.
+                    }
+                    else
+                    {
+                        // C[i] = [!M .* C]  U  T[i], z = "merge"
+                        C_row.clear();
+                        masked_merge(C_row,
+                                     M[i], structure_flag, complement_flag,
+                                     C[i], T_row);
+                        C.setRow(i, C_row);
+                    }
+                });
         }
 
         //**********************************************************************
@@ -209,48 +225,53 @@ namespace grb
             typename LilSparseMatrix<ZScalarType>::RowType Z_row;
             typename LilSparseMatrix<CScalarT>::RowType    C_row;
 
-            for (IndexType i = 0; i < A.nrows(); ++i) // compute row i of answer
-            {
-                bool const complement_flag = false;  /// @todo constexpr?
-                T_row.clear();
+            ProductRowSchedule sched;
+            schedule_product_rows(sched, A, B, false);
 
-                if (!M[i].empty())
+            parallel_product_rows(
+                sched,
+                [&, T_row, Z_row, C_row](IndexType i) mutable
                 {
-                    for (auto const &Ai_elt : A[i])
-                    {
-                        IndexType    k(std::get<0>(Ai_elt));
-                        AScalarT  a_ik(std::get<1>(Ai_elt));
-
-                        if (B[k].empty()) continue;
+                    bool const complement_flag = false;  /// @todo constexpr?
+                    T_row.clear();
 
-                        // T[i] += M[i] .* a_ik*B[k]
-                        masked_axpy(T_row,
-                                    M[i], structure_flag, complement_flag,
-                                    semiring, a_ik, B[k]);
+                    if (!M[i].empty())
+                    {
+                        for (auto const &Ai_elt : A[i])
+                        {
+                            IndexType    k(std::get<0>(Ai_elt));
+                            AScalarT  a_ik(std::get<1>(Ai_elt));
+
+                            if (B[k].empty()) continue;
+
+                            // T[i] += M[i] .* a_ik*B[k]
+                            masked_axpy(T_row,
+                                        M[i], structure_flag, complement_flag,
+                                        semiring, a_ik, B[k]);
+                        }
                     }
-                }
-
-                // Z[i] = (M .* C) + T[i]
-                Z_row.clear();
-                masked_accum(Z_row,
-                             M[i], structure_flag, complement_flag,
-                             accum, C[i], T_row);
 
-                if (outp == MERGE)
-                {
-                    // C[i]  = [!M .* C]  U  Z[i]
-                    C_row.clear();
-                    masked_merge(C_row,
+                    // Z[i] = (M .* C) + T[i]
+                    Z_row.clear();
+                    masked_accum(Z_row,
                                  M[i], structure_flag, complement_flag,
-                                 C[i], Z_row);
-                    C.setRow(i, C_row);  // set even if it is empty.
-                }
-                else // z = replace
-                {
-                    // C[i] = Z[i]
-                    C.setRow(i, Z_row);
-                }
-            }
+                                 accum, C[i], T_row);
+
+                    if (outp == MERGE)
+                    {
+                        // C[i]  = [!M .* C]  U  Z[i]
+                        C_row.clear();
+                        masked_merge(C_row,
+                                     M[i], structure_flag, complement_flag,
+                                     C[i], Z_row);
+                        C.setRow(i, C_row);  // set even if it is empty.
+                    }
+                    else // z = replace
+                    {
+                        // C[i] = Z[i]
+                        C.setRow(i, Z_row);
+                    }
+                });
         }
 
         //**********************************************************************
@@ -274,41 +295,46 @@ namespace grb
             typename LilSparseMatrix<TScalarType>::RowType T_row;
             typename LilSparseMatrix<CScalarT>::RowType    Z_row;
 
-            for (IndexType i = 0; i < A.nrows(); ++i) // compute row i of answer
-            {
-                // if M[i] is empty it is like NoMask_NoAccum
-
-                bool const complement_flag = true;
+            ProductRowSchedule sched;
+            schedule_product_rows(sched, A, B, false);
 
-                T_row.clear();
-                for (auto const &Ai_elt : A[i])
+            parallel_product_rows(
+                sched,
+                [&, T_row, Z_row](IndexType i) mutable
                 {
-                    IndexType    k(std::get<0>(Ai_elt));
-                    AScalarT  a_ik(std::get<1>(Ai_elt));
+                    // if M[i] is empty it is like NoMask_NoAccum
 
-                    if (B[k].empty()) continue;
+                    bool const complement_flag = true;
 
-                    // T[i] += !M[i] .* (a_ik*B[k])  // must reduce in D3
-                    masked_axpy(T_row,
-                                M[i], structure_flag, complement_flag,
-                                semiring, a_ik, B[k]);
-                }
+                    T_row.clear();
+                    for (auto const &Ai_elt : A[i])
+                    {
+                        IndexType    k(std::get<0>(Ai_elt));
+                        AScalarT  a_ik(std::get<1>(Ai_elt));
 
-                if ((outp == REPLACE) || M[i].empty())
-                {
-                    // C[i] = T[i]
-                    C.setRow(i, T_row);  // set even if it is empty.
-                }
-                else
-                {
-                    Z_row.clear();
-                    // Z[i] = (M[i] .* C[i]) U T[i]
-                    masked_merge(Z_row,
-                                 M[i], structure_flag, complement_flag,
-                                 C[i], T_row);
-                    C.setRow(i, Z_row);
-                }
-            }
+                        if (B[k].empty()) continue;
+
+                        // T[i] += !M[i] .* (a_ik*B[k])  // must reduce in D3
+                        masked_axpy(T_row,
+                                    M[i], structure_flag, complement_flag,
+                                    semiring, a_ik, B[k]);
+                    }
+
+                    if ((outp == REPLACE) || M[i].empty())
+                    {
+                        // C[i] = T[i]
+                        C.setRow(i, T_row);  // set even if it is empty.
+                    }
+                    else
+                    {
+                        Z_row.clear();
+                        // Z[i] = (M[i] .* C[i]) U T[i]
+                        masked_merge(Z_row,
+                                     M[i], structure_flag, complement_flag,
+                                     C[i], T_row);
+                        C.setRow(i, Z_row);
+                    }
+                });
         }
 
         //**********************************************************************
@@ -336,47 +362,52 @@ namespace grb
             typename LilSparseMatrix<ZScalarType>::RowType Z_row;
             typename LilSparseMatrix<CScalarT>::RowType    C_row;
 
-            for (IndexType i = 0; i < A.nrows(); ++i) // compute row i of answer
-            {
-                // if M[i] is empty it is like NoMask_NoAccum
-
-                bool const complement_flag = true;
+            ProductRowSchedule sched;
+            schedule_product_rows(sched, A, B, false);
 
-                T_row.clear();
-                for (auto const &Ai_elt : A[i])
+            parallel_product_rows(
+                sched,
+                [&, T_row, Z_row, C_row](IndexType i) mutable
                 {
-                    IndexType    k(std::get<0>(Ai_elt));
-                    AScalarT  a_ik(std::get<1>(Ai_elt));
+                    // if M[i] is empty it is like NoMask_NoAccum
 
-                    if (B[k].empty()) continue;
+                    bool const complement_flag = true;
 
-                    // T[i] += !M[i] .* (a_ik*B[k])  // must reduce in D3
-                    masked_axpy(T_row,
-                                M[i], structure_flag, complement_flag,
-                                semiring, a_ik, B[k]);
-                }
+                    T_row.clear();
+                    for (auto const &Ai_elt : A[i])
+                    {
+                        IndexType    k(std::get<0>(Ai_elt));
+                        AScalarT  a_ik(std::get<1>(Ai_elt));
 
-                // Z[i] = (!M[i] .* C[i]) + T[i], where T[i] is masked by !M[i]
-                Z_row.clear();
-                masked_accum(Z_row,
-                             M[i], structure_flag, complement_flag,
-                             accum, C[i], T_row);
+                        if (B[k].empty()) continue;
 
-                if ((outp == REPLACE) || M[i].empty())
-                {
-                    C.setRow(i, Z_row);
-                }
-                else /* merge */
-                {
-                    // C[i] = [M[i] .* C[i]]  U  Z[i], where Z is disjoint from M
-                    C_row.clear();  // TODO: is an extra vector necessary?
-                    masked_merge(C_row,
+                        // T[i] += !M[i] .* (a_ik*B[k])  // must reduce in D3
+                        masked_axpy(T_row,
+                                    M[i], structure_flag, complement_flag,
+                                    semiring, a_ik, B[k]);
+                    }
+
+                    // Z[i] = (!M[i] .* C[i]) + T[i], where T[i] is masked by !M[i]
+                    Z_row.clear();
+                    masked_accum(Z_row,
                                  M[i], structure_flag, complement_flag,
-                                 C[i], Z_row);
-                    C.setRow(i, C_row);
-                }
+                                 accum, C[i], T_row);
 
-            }
+                    if ((outp == REPLACE) || M[i].empty())
+                    {
+                        C.setRow(i, Z_row);
+                    }
+                    else /* merge */
+                    {
+                        // C[i] = [M[i] .* C[i]]  U  Z[i], where Z is disjoint from M
+                        C_row.clear();  // TODO: is an extra vector necessary?
+                        masked_merge(C_row,
+                                     M[i], structure_flag, complement_flag,
+                                     C[i], Z_row);
+                        C.setRow(i, C_row);
+                    }
+
+                });
         }
 
         //**********************************************************************
@@ -446,6 +477,7 @@ namespace grb
                 // create temporary to prevent overwrite of inputs
                 LilSparseMatrix<CScalarT> Ctmp(C.nrows(), C.ncols());
                 AB_NoMask_NoAccum_kernel(Ctmp, semiring, A, B);
+#pragma omp parallel for schedule(dynamic, 64)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     C.mergeRow(i, Ctmp[i], accum);
@@ -508,6 +540,7 @@ namespace grb
                 else
                 {
                     typename LilSparseMatrix<CScalarT>::RowType C_row;
+#pragma omp parallel for schedule(dynamic, 64) private(C_row)
                     for (IndexType i = 0; i < C.nrows(); ++i)
                     {
                         // C[i] = [!M .* C]  U  T[i], z = "merge"
@@ -578,6 +611,7 @@ namespace grb
 
                 typename LilSparseMatrix<ZScalarType>::RowType  Z_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(Z_row)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     Z_row.clear();
@@ -656,6 +690,7 @@ namespace grb
                 else
                 {
                     typename LilSparseMatrix<CScalarT>::RowType C_row;
+#pragma omp parallel for schedule(dynamic, 64) private(C_row)
                     for (IndexType i = 0; i < C.nrows(); ++i)
                     {
                         // C[i] = [!M .* C]  U  T[i], z = "merge"
@@ -723,6 +758,7 @@ namespace grb
 
                 typename LilSparseMatrix<ZScalarType>::RowType  Z_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(Z_row)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     Z_row.clear();
@@ -67,6 +67,7 @@ namespace grb
             using TScalarType = typename SemiringT::result_type;
             typename LilSparseMatrix<CScalarT>::RowType C_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(C_row)
             for (IndexType i = 0; i < A.nrows(); ++i)
             {
                 C_row.clear();
@@ -108,6 +109,7 @@ namespace grb
             using TScalarType = typename SemiringT::result_type;
             std::vector<std::tuple<IndexType,TScalarType> > T_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(T_row)
             for (IndexType i = 0; i < A.nrows(); ++i)
             {
                 if (A[i].empty()) continue;
@@ -158,6 +160,7 @@ namespace grb
             typename LilSparseMatrix<TScalarType>::RowType T_row;
             typename LilSparseMatrix<CScalarT>::RowType C_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(T_row, C_row)
             for (IndexType i = 0; i < A.nrows(); ++i)
             {
                 bool const complement_flag = false;
@@ -225,6 +228,7 @@ namespace grb
             typename LilSparseMatrix<ZScalarType>::RowType  Z_row;
             typename LilSparseMatrix<CScalarT>::RowType     C_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(T_row, Z_row, C_row)
             for (IndexType i = 0; i < A.nrows(); ++i)
             {
                 bool const complement_flag = false;  /// @todo constexpr?
@@ -296,6 +300,7 @@ namespace grb
             typename LilSparseMatrix<TScalarType>::RowType T_row;
             typename LilSparseMatrix<CScalarT>::RowType    C_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(T_row, C_row)
             for (IndexType i = 0; i < A.nrows(); ++i)
             {
                 bool const complement_flag = true;
@@ -364,6 +369,7 @@ namespace grb
             typename LilSparseMatrix<ZScalarType>::RowType Z_row;
             typename LilSparseMatrix<CScalarT>::RowType    C_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(T_row, Z_row, C_row)
             for (IndexType i = 0; i < A.nrows(); ++i)
             {
                 bool const complement_flag = true;
@@ -487,6 +493,7 @@ namespace grb
                 // create temporary to prevent overwrite of inputs
                 LilSparseMatrix<CScalarT> Ctmp(C.nrows(), C.ncols());
                 ABT_NoMask_NoAccum_kernel(Ctmp, semiring, A, B);
+#pragma omp parallel for schedule(dynamic, 64)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     C.mergeRow(i, Ctmp[i], accum);
@@ -551,6 +558,7 @@ namespace grb
                 else
                 {
                     typename LilSparseMatrix<CScalarT>::RowType C_row;
+#pragma omp parallel for schedule(dynamic, 64) private(C_row)
                     for (IndexType i = 0; i < C.nrows(); ++i)
                     {
                         // C[i] = [!M .* C]  U  T[i], z = "merge"
@@ -623,6 +631,7 @@ namespace grb
 
                 typename LilSparseMatrix<ZScalarType>::RowType  Z_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(Z_row)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     Z_row.clear();
@@ -704,6 +713,7 @@ namespace grb
                 else
                 {
                     typename LilSparseMatrix<CScalarT>::RowType C_row;
+#pragma omp parallel for schedule(dynamic, 64) private(C_row)
                     for (IndexType i = 0; i < C.nrows(); ++i)
                     {
                         // C[i] = [!M .* C]  U  T[i], z = "merge"
@@ -767,6 +777,7 @@ namespace grb
 
                 typename LilSparseMatrix<ZScalarType>::RowType  Z_row;
 
+#pragma omp parallel for schedule(dynamic, 64) private(Z_row)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     Z_row.clear();
@@ -64,14 +64,19 @@ namespace grb
             LilSparseMatrix<AScalarT> const &A,
             LilSparseMatrix<BScalarT> const &B)
         {
-            for (IndexType k = 0; k < A.nrows(); ++k)
-            {
-                if (A[k].empty() || B[k].empty()) continue;
+            // Transpose A so that each row of T is owned by one thread
+            LilSparseMatrix<AScalarT> AT(A.ncols(), A.nrows());
+            parallel_transpose(AT, A);
 
-                for (auto const &Ak_elt : A[k])
+#pragma omp parallel for schedule(dynamic, 64)
+            for (IndexType i = 0; i < AT.nrows(); ++i)
+            {
+                for (auto const &ATi_elt : AT[i])
                 {
-                    IndexType    i(std::get<0>(Ak_elt));
-                    AScalarT  a_ki(std::get<1>(Ak_elt));
+                    IndexType    k(std::get<0>(ATi_elt));
+                    AScalarT  a_ki(std::get<1>(ATi_elt));
+
+                    if (B[k].empty()) continue;
 
                     // T[i] += (a_ki*B[k])  // must reduce in D3, hence T.
                     axpy(T[i], semiring, a_ki, B[k]);
@@ -94,16 +99,21 @@ namespace grb
             LilSparseMatrix<AScalarT> const &A,
             LilSparseMatrix<BScalarT> const &B)
         {
-            for (IndexType k = 0; k < A.nrows(); ++k)
+            // Transpose A so that each row of T is owned by one thread
+            LilSparseMatrix<AScalarT> AT(A.ncols(), A.nrows());
+            parallel_transpose(AT, A);
+
+#pragma omp parallel for schedule(dynamic, 64)
+            for (IndexType i = 0; i < AT.nrows(); ++i)
             {
-                if (A[k].empty() || B[k].empty()) continue;
+                if (M[i].empty()) continue;
 
-                for (auto const &Ak_elt : A[k])
+                for (auto const &ATi_elt : AT[i])
                 {
-                    IndexType    i(std::get<0>(Ak_elt));
-                    AScalarT  a_ki(std::get<1>(Ak_elt));
+                    IndexType    k(std::get<0>(ATi_elt));
+                    AScalarT  a_ki(std::get<1>(ATi_elt));
 
-                    if (M[i].empty()) continue;
+                    if (B[k].empty()) continue;
 
                     // T[i] += M[i] .* (a_ki*B[k])  // must reduce in D3, hence T.
                     masked_axpy(T[i],
@@ -128,14 +138,19 @@ namespace grb
             LilSparseMatrix<AScalarT> const &A,
             LilSparseMatrix<BScalarT> const &B)
         {
-            for (IndexType k = 0; k < A.nrows(); ++k)
-            {
-                if (A[k].empty() || B[k].empty()) continue;
+            // Transpose A so that each row of T is owned by one thread
+            LilSparseMatrix<AScalarT> AT(A.ncols(), A.nrows());
+            parallel_transpose(AT, A);
 
-                for (auto const &Ak_elt : A[k])
+#pragma omp parallel for schedule(dynamic, 64)
+            for (IndexType i = 0; i < AT.nrows(); ++i)
+            {
+                for (auto const &ATi_elt : AT[i])
                 {
-                    IndexType    i(std::get<0>(Ak_elt));
-                    AScalarT  a_ki(std::get<1>(Ak_elt));
+                    IndexType    k(std::get<0>(ATi_elt));
+                    AScalarT  a_ki(std::get<1>(ATi_elt));
+
+                    if (B[k].empty()) continue;
 
                     // T[i] += !M[i] .* (a_ki*B[k])  // must reduce in D3, hence T.
                     masked_axpy(T[i],
@@ -174,6 +189,7 @@ namespace grb
 
             ATB_NoMask_kernel(T, semiring, A, B);
 
+#pragma omp parallel for schedule(dynamic, 64)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 // C[i] = T[i]
@@ -210,6 +226,7 @@ namespace grb
 
             ATB_NoMask_kernel(T, semiring, A, B);
 
+#pragma omp parallel for schedule(dynamic, 64)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 if (!T[i].empty())
@@ -260,6 +277,7 @@ namespace grb
 
             if (outp == MERGE)
             {
+#pragma omp parallel for schedule(dynamic, 64) private(C_row)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     // C[i] = (!M[i] .* C[i])  U  T[i], z = "merge"
@@ -272,6 +290,7 @@ namespace grb
             }
             else
             {
+#pragma omp parallel for schedule(dynamic, 64)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     C.setRow(i, T[i]);
@@ -322,6 +341,7 @@ namespace grb
 
             ATB_Mask_kernel(T, M, structure_flag, semiring, A, B);
 
+#pragma omp parallel for schedule(dynamic, 64) private(Z_row, C_row)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 // Z[i] = (M[i] .* C[i]) + T[i]
@@ -382,6 +402,7 @@ namespace grb
 
             ATB_CompMask_kernel(T, M, structure_flag, semiring, A, B);
 
+#pragma omp parallel for schedule(dynamic, 64) private(C_row)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 if ((outp == REPLACE) || M[i].empty())
@@ -438,6 +459,7 @@ namespace grb
 
             ATB_CompMask_kernel(T, M, structure_flag, semiring, A, B);
 
+#pragma omp parallel for schedule(dynamic, 64) private(Z_row, C_row)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 // Z[i] = (!M .* C) + T[i]
@@ -60,15 +60,14 @@ namespace grb
             LilSparseMatrix<AScalarT> const &A,
             LilSparseMatrix<BScalarT> const &B)
         {
-            C.clear();
             using TScalarType = typename SemiringT::result_type;
-            typename LilSparseMatrix<TScalarType>::RowType T_row;
+            LilSparseMatrix<TScalarType> T(B.nrows(), A.ncols());
 
-            // compute transpose T = B +.* A (one row at a time and transpose)
+            // compute T = B +.* A (rows in parallel) then C = T'
+#pragma omp parallel for schedule(dynamic, 64)
             for (IndexType i = 0; i < B.nrows(); ++i)
             {
                 // this part is same as sparse_mxm_NoMask_NoAccum_AB
-                T_row.clear();
                 for (auto const &Bi_elt : B[i])
                 {
                     IndexType    k(std::get<0>(Bi_elt));
@@ -77,18 +76,11 @@ namespace grb
                     if (A[k].empty()) continue;
 
                     // T[i] += (b_ik*A[k])  // must reduce in D3
-                    axpy(T_row, semiring, b_ik, A[k]);
-                }
-
-                //C.setCol(i, T_row); // this is a push_back form of setCol
-                for (auto const &t : T_row)
-                {
-                    IndexType j(std::get<0>(t));
-
-                    C[j].emplace_back(i, static_cast<CScalarT>(std::get<1>(t)));
+                    axpy(T[i], semiring, b_ik, A[k]);
                 }
             }
-            C.recomputeNvals();
+
+            parallel_transpose(C, T);
         }
 
         //**********************************************************************
@@ -114,15 +106,12 @@ namespace grb
                 return;
             }
 
-            // =================================================================
-            using TScalarType = typename SemiringT::result_type;
-            typename LilSparseMatrix<TScalarType>::RowType T_row;
-
             if (((void*)&C == (void*)&A) || ((void*)&C == (void*)&B))
             {
                 LilSparseMatrix<CScalarT> Ctmp(C.nrows(), C.ncols());
                 ATBT_NoMask_NoAccum_kernel(Ctmp, semiring, A, B);
 
+#pragma omp parallel for schedule(dynamic, 64)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     C.setRow(i, Ctmp[i]);
@@ -166,6 +155,7 @@ namespace grb
                 // T = A' +.* B'
                 LilSparseMatrix<TScalarType> T(C.nrows(), C.ncols());
                 ATBT_NoMask_NoAccum_kernel(T, semiring, A, B);
+#pragma omp parallel for schedule(dynamic, 64)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     // C[i] = C[i] + T[i]
@@ -174,11 +164,11 @@ namespace grb
             }
             else
             {
-                typename LilSparseMatrix<TScalarType>::RowType T_row;
                 LilSparseMatrix<TScalarType> T(C.nrows(), C.ncols());
                 ATBT_NoMask_NoAccum_kernel(T, semiring, A, B);
 
                 // accumulate
+#pragma omp parallel for schedule(dynamic, 64)
                 for (IndexType i = 0; i < C.nrows(); ++i)
                 {
                     // C[i] = C[i] + T[i]
@@ -219,37 +209,13 @@ namespace grb
 
             // =================================================================
             using TScalarType = typename SemiringT::result_type;
-            typename LilSparseMatrix<TScalarType>::RowType T_row;
             LilSparseMatrix<TScalarType> T(C.nrows(), C.ncols());
 
-            // compute transpose T = B +.* A (one row at a time and transpose)
-            for (IndexType i = 0; i < B.nrows(); ++i)
-            {
-                // this part is same as sparse_mxm_NoMask_NoAccum_AB swapping
-                // A and B and computing the transpose of C.
-                T_row.clear();
-
-                for (auto const &Bi_elt : B[i])
-                {
-                    IndexType    k(std::get<0>(Bi_elt));
-                    AScalarT  b_ik(std::get<1>(Bi_elt));
-
-                    if (A[k].empty()) continue;
-
-                    // T[i] += (b_ik*A[k])  // must reduce in D3
-                    axpy(T_row, semiring, b_ik, A[k]);
-                }
-
-                // Transpose the result
-                //T.setCol(i, T_row); // this is a push_back form of setCol
-                for (auto const &t : T_row)
-                {
-                    IndexType j(std::get<0>(t));
-                    T[j].push_back(std::make_pair(i, std::get<1>(t)));
-                }
-            }
+            // compute T = (B +.* A)'
+            ATBT_NoMask_NoAccum_kernel(T, semiring, A, B);
 
             typename LilSparseMatrix<CScalarT>::RowType Z_row, C_row;
+#pragma omp parallel for schedule(dynamic, 64) private(Z_row, C_row)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 // Z = M[i] .* T[i]
@@ -321,35 +287,12 @@ namespace grb
             typename LilSparseMatrix<CScalarT>::RowType    C_row;
             LilSparseMatrix<TScalarType> T(C.nrows(), C.ncols());
 
-            // compute transpose T' = B +.* A (one row at a time and transpose)
-            for (IndexType i = 0; i < B.nrows(); ++i)
-            {
-                // this part is same as sparse_mxm_NoMask_NoAccum_AB swapping
-                // A and B and computing the transpose of C.
-                T_row.clear();
-
-                for (auto const &Bi_elt : B[i])
-                {
-                    IndexType    k(std::get<0>(Bi_elt));
-                    AScalarT  b_ik(std::get<1>(Bi_elt));
-
-                    if (A[k].empty()) continue;
-
-                    // T[i] += (b_ik*A[k])  // must reduce in D3
-                    axpy(T_row, semiring, b_ik, A[k]);
-                }
-
-                // Transpose the result
-                //T.setCol(i, T_row); // this is a push_back form of setCol
-                for (auto const &t : T_row)
-                {
-                    IndexType j(std::get<0>(t));
-                    T[j].push_back(std::make_pair(i, std::get<1>(t)));
-                }
-            }
+            // compute T = (B +.* A)'
+            ATBT_NoMask_NoAccum_kernel(T, semiring, A, B);
 
             bool const complement_flag = false;
 
+#pragma omp parallel for schedule(dynamic, 64) private(T_row, Z_row, C_row)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 // T_row = M[i] .* T[i]
@@ -415,37 +358,13 @@ namespace grb
 
             // =================================================================
             using TScalarType = typename SemiringT::result_type;
-            typename LilSparseMatrix<TScalarType>::RowType T_row;
             LilSparseMatrix<TScalarType> T(C.nrows(), C.ncols());
 
-            // compute transpose T = B +.* A (one row at a time and transpose)
-            for (IndexType i = 0; i < B.nrows(); ++i)
-            {
-                // this part is same as sparse_mxm_NoMask_NoAccum_AB swapping
-                // A and B and computing the transpose of C.
-                T_row.clear();
-
-                for (auto const &Bi_elt : B[i])
-                {
-                    IndexType    k(std::get<0>(Bi_elt));
-                    AScalarT  b_ik(std::get<1>(Bi_elt));
-
-                    if (A[k].empty()) continue;
-
-                    // T[i] += (b_ik*A[k])  // must reduce in D3
-                    axpy(T_row, semiring, b_ik, A[k]);
-                }
-
-                // Transpose the result
-                //T.setCol(i, T_row); // this is a push_back form of setCol
-                for (auto const &t : T_row)
-                {
-                    IndexType j(std::get<0>(t));
-                    T[j].push_back(std::make_pair(i, std::get<1>(t)));
-                }
-            }
+            // compute T = (B +.* A)'
+            ATBT_NoMask_NoAccum_kernel(T, semiring, A, B);
 
             typename LilSparseMatrix<CScalarT>::RowType Z_row, C_row;
+#pragma omp parallel for schedule(dynamic, 64) private(Z_row, C_row)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 // Z = !M[i] .* T[i]
@@ -516,35 +435,12 @@ namespace grb
             typename LilSparseMatrix<CScalarT>::RowType C_row;
             LilSparseMatrix<TScalarType> T(C.nrows(), C.ncols());
 
-            // compute transpose T' = B +.* A (one row at a time and transpose)
-            for (IndexType i = 0; i < B.nrows(); ++i)
-            {
-                // this part is same as sparse_mxm_NoMask_NoAccum_AB swapping
-                // A and B and computing the transpose of C.
-                T_row.clear();
-
-                for (auto const &Bi_elt : B[i])
-                {
-                    IndexType    k(std::get<0>(Bi_elt));
-                    AScalarT  b_ik(std::get<1>(Bi_elt));
-
-                    if (A[k].empty()) continue;
-
-                    // T[i] += (b_ik*A[k])  // must reduce in D3
-                    axpy(T_row, semiring, b_ik, A[k]);
-                }
-
-                // Transpose the result
-                //T.setCol(i, T_row); // this is a push_back form of setCol
-                for (auto const &t : T_row)
-                {
-                    IndexType j(std::get<0>(t));
-                    T[j].push_back(std::make_pair(i, std::get<1>(t)));
-                }
-            }
+            // compute T = (B +.* A)'
+            ATBT_NoMask_NoAccum_kernel(T, semiring, A, B);
 
             bool const complement_flag = true;
 
+#pragma omp parallel for schedule(dynamic, 64) private(T_row, Z_row, C_row)
             for (IndexType i = 0; i < C.nrows(); ++i)
             {
                 // T_row = M[i] .* T[i]
@@ -0,0 +1,278 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * DM20-0442
+ */
+
+
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <vector>
+#include <iterator>
+#include <iostream>
+#include <memory>
+
+#include <graphblas/detail/logging.h>
+#include <graphblas/types.hpp>
+#include <graphblas/algebra.hpp>
+
+#include "sparse_helpers.hpp"
+#include "LilSparseMatrix.hpp"
+
+//****************************************************************************
+
+namespace grb
+{
+    namespace backend
+    {
+        //**********************************************************************
+        /// The rows of A: the matrix itself, or an explicit copy of the
+        /// transpose (held in tmp) when A is a TransposeView.
+        template <typename MatrixT, typename ScalarT>
+        auto const &rows_of(MatrixT                                const &A,
+                            std::unique_ptr<LilSparseMatrix<ScalarT>>    &tmp)
+        {
+            if constexpr (is_transpose_v<MatrixT>)
+            {
+                auto const &M(A.m_mat);
+                tmp = std::make_unique<LilSparseMatrix<ScalarT>>(M.ncols(),
+                                                                 M.nrows());
+                parallel_transpose(*tmp, M);
+                return static_cast<LilSparseMatrix<ScalarT> const &>(*tmp);
+            }
+            else
+            {
+                return A;
+            }
+        }
+
+        //**********************************************************************
+        /// Core of the fused mxm + reduce: val = reduce(monoid, (A*B)<M>)
+        ///
+        /// The product is computed one row at a time into a scratch row that
+        /// is reduced immediately; when B is transposed and the mask is not
+        /// complemented only the masked dot products are computed.  No output
+        /// matrix is ever allocated.
+        template<typename ValueT,
+                 typename MaskRowFnT,
+                 typename MonoidT,
+                 typename SemiringT,
+                 typename AMatrixT,
+                 typename BMatrixT>
+        inline void mxm_reduce_rows(ValueT            &val,
+                                    MaskRowFnT         mask_row,
+                                    bool               structure_flag,
+                                    bool               complement_flag,
+                                    MonoidT            monoid,
+                                    SemiringT          op,
+                                    AMatrixT   const  &A,
+                                    BMatrixT   const  &B)
+        {
+            using TScalarType = typename SemiringT::result_type;
+            using ZScalarType = decltype(monoid(std::declval<TScalarType>(),
+                                                std::declval<TScalarType>()));
+            ZScalarType z = monoid.identity();
+
+            if constexpr (is_transpose_v<BMatrixT>)
+            {
+                if (!complement_flag)
+                {
+                    // Only the dot products selected by the mask
+                    std::unique_ptr<LilSparseMatrix<
+                        typename AMatrixT::ScalarType>> A_tmp;
+                    auto const &Ar(rows_of(A, A_tmp));
+                    auto const &Bm(B.m_mat);
+
+                    ZScalarType tmp;
+                    if (parallel_reduce_rows(
+                            tmp, Ar.nrows(), monoid,
+                            [&](IndexType i, ZScalarType &row_val)
+                            {
+                                bool row_set(false);
+                                if (Ar[i].empty()) return row_set;
+
+                                for (auto&& [j, m_ij] : mask_row(i))
+                                {
+                                    TScalarType t_ij;
+                                    if ((structure_flag ||
+                                         static_cast<bool>(m_ij)) &&
+                                        dot(t_ij, Ar[i], Bm[j], op))
+                                    {
+                                        row_val = row_set ?
+                                            monoid(row_val, t_ij) :
+                                            static_cast<ZScalarType>(t_ij);
+                                        row_set = true;
+                                        if (is_terminal(monoid, row_val)) break;
+                                    }
+                                }
+                                return row_set;
+                            }))
+                    {
+                        z = monoid(z, tmp);
+                    }
+
+                    val = static_cast<ValueT>(z);
+                    return;
+                }
+            }
+
+            // Row-wise (Gustavson) product into a scratch row
+            std::unique_ptr<LilSparseMatrix<typename AMatrixT::ScalarType>> A_tmp;
+            std::unique_ptr<LilSparseMatrix<typename BMatrixT::ScalarType>> B_tmp;
+            auto const &Ar(rows_of(A, A_tmp));
+            auto const &Br(rows_of(B, B_tmp));
+
+            // Each block of rows reuses its own copy of the scratch row
+            std::vector<std::tuple<IndexType, TScalarType>> t_row;
+            ZScalarType tmp;
+            if (parallel_reduce_rows(
+                    tmp, Ar.nrows(), monoid,
+                    [&, t_row](IndexType i, ZScalarType &row_val) mutable
+                    {
+                        auto const &m_i(mask_row(i));
+                        if (Ar[i].empty() || (m_i.empty() && !complement_flag))
+                        {
+                            return false;
+                        }
+
+                        t_row.clear();
+                        for (auto&& [k, a_ik] : Ar[i])
+                        {
+                            if (!Br[k].empty())
+                            {
+                                masked_axpy(t_row, m_i, structure_flag,
+                                            complement_flag, op, a_ik, Br[k]);
+                            }
+                        }
+
+                        return reduction(row_val, t_row, monoid);
+                    }))
+            {
+                z = monoid(z, tmp);
+            }
+
+            val = static_cast<ValueT>(z);
+        }
+
+        //**********************************************************************
+        /// Fused mxm + reduce to scalar: val = reduce(monoid, (A*B)<M>)
+        //**********************************************************************
+        template<typename ValueT,
+                 typename MMatrixT,
+                 typename MonoidT,
+                 typename SemiringT,
+                 typename AMatrixT,
+                 typename BMatrixT>
+        inline void mxm_reduce(ValueT            &val,
+                               MMatrixT   const  &M,
+                               MonoidT            monoid,
+                               SemiringT          op,
+                               AMatrixT   const  &A,
+                               BMatrixT   const  &B)
+        {
+            GRB_LOG_VERBOSE("val := reduce((A*B)<M>)");
+            mxm_reduce_rows(val, [&M](IndexType i) -> auto const & { return M[i]; },
+                            false, false, monoid, op, A, B);
+        }
+
+        template<typename ValueT,
+                 typename MonoidT,
+                 typename SemiringT,
+                 typename AMatrixT,
+                 typename BMatrixT>
+        inline void mxm_reduce(ValueT            &val,
+                               NoMask     const  &,
+                               MonoidT            monoid,
+                               SemiringT          op,
+                               AMatrixT   const  &A,
+                               BMatrixT   const  &B)
+        {
+            GRB_LOG_VERBOSE("val := reduce(A*B)");
+            std::vector<std::tuple<IndexType, bool>> const empty_row;
+            mxm_reduce_rows(val,
+                            [&empty_row](IndexType) -> auto const & { return empty_row; },
+                            false, true, monoid, op, A, B);
+        }
+
+        template<typename ValueT,
+                 typename MMatrixT,
+                 typename MonoidT,
+                 typename SemiringT,
+                 typename AMatrixT,
+                 typename BMatrixT>
+        inline void mxm_reduce(ValueT                               &val,
+                               MatrixStructureView<MMatrixT> const  &M_view,
+                               MonoidT                               monoid,
+                               SemiringT                             op,
+                               AMatrixT                      const  &A,
+                               BMatrixT                      const  &B)
+        {
+            GRB_LOG_VERBOSE("val := reduce((A*B)<struct(M)>)");
+            auto const &M(M_view.m_mat);
+            mxm_reduce_rows(val, [&M](IndexType i) -> auto const & { return M[i]; },
+                            true, false, monoid, op, A, B);
+        }
+
+        template<typename ValueT,
+                 typename MMatrixT,
+                 typename MonoidT,
+                 typename SemiringT,
+                 typename AMatrixT,
+                 typename BMatrixT>
+        inline void mxm_reduce(ValueT                                &val,
+                               MatrixComplementView<MMatrixT> const  &M_view,
+                               MonoidT                                monoid,
+                               SemiringT                              op,
+                               AMatrixT                       const  &A,
+                               BMatrixT                       const  &B)
+        {
+            GRB_LOG_VERBOSE("val := reduce((A*B)<!M>)");
+            auto const &M(M_view.m_mat);
+            mxm_reduce_rows(val, [&M](IndexType i) -> auto const & { return M[i]; },
+                            false, true, monoid, op, A, B);
+        }
+
+        template<typename ValueT,
+                 typename MMatrixT,
+                 typename MonoidT,
+                 typename SemiringT,
+                 typename AMatrixT,
+                 typename BMatrixT>
+        inline void mxm_reduce(
+            ValueT                                          &val,
+            MatrixStructuralComplementView<MMatrixT> const  &M_view,
+            MonoidT                                          monoid,
+            SemiringT                                        op,
+            AMatrixT                                 const  &A,
+            BMatrixT                                 const  &B)
+        {
+            GRB_LOG_VERBOSE("val := reduce((A*B)<!struct(M)>)");
+            auto const &M(M_view.m_mat);
+            mxm_reduce_rows(val, [&M](IndexType i) -> auto const & { return M[i]; },
+                            true, true, monoid, op, A, B);
+        }
+    } // backend
+} // grb
@@ -68,33 +68,24 @@ namespace grb
 
             if (A.nvals() > 0)
             {
-                for (IndexType row_idx = 0; row_idx < A.nrows(); ++row_idx)
-                {
-                    /// @todo There is something hinky with domains here.  How
-                    /// does one perform the reduction in A domain but produce
-                    /// partial results in D3(op)?
-                    TScalarType t_val;
-                    if (reduction(t_val, A[row_idx], op))
+                parallel_gather_rows(
+                    t, A.nrows(),
+                    [&](IndexType row_idx, auto &t_part)
                     {
-                        t.emplace_back(row_idx, t_val);
-                    }
-                }
+                        /// @todo There is something hinky with domains here.  How
+                        /// does one perform the reduction in A domain but produce
+                        /// partial results in D3(op)?
+                        TScalarType t_val;
+                        if (reduction(t_val, A[row_idx], op))
+                        {
+                            t_part.emplace_back(row_idx, t_val);
+                        }
+                    });
             }
 
             // =================================================================
-            // Accumulate into Z
-            // Type generator for z: D3(accum), or D(w) if no accum.
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<typename WVectorT::ScalarType>(),
-                               std::declval<TScalarType>()))>;
-            std::vector<std::tuple<IndexType, ZScalarType> > z;
-            ewise_or_opt_accum_1D(z, w, t, accum);
-
-            // =================================================================
-            // Copy Z into the final output, w, considering mask and replace/merge
-            write_with_opt_mask_1D(w, z, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t, mask, accum, outp);
         }
 
         //********************************************************************
@@ -135,19 +126,8 @@ namespace grb
             }
 
             // =================================================================
-            // Accumulate into Z
-            // Type generator for z: D3(accum), or D(w) if no accum.
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<typename WVectorT::ScalarType>(),
-                               std::declval<TScalarType>()))>;
-            std::vector<std::tuple<IndexType, ZScalarType> > z;
-            ewise_or_opt_accum_1D(z, w, t, accum);
-
-            // =================================================================
-            // Copy Z into the final output, w, considering mask and replace/merge
-            write_with_opt_mask_1D(w, z, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t, mask, accum, outp);
         }
 
         //********************************************************************
@@ -171,7 +151,16 @@ namespace grb
 
             if (u.nvals() > 0)
             {
-                reduction(t, u.getContents(), op);
+                auto const &u_bitmap(u.get_bitmap());
+                auto const &u_vals(u.get_vals());
+                parallel_reduce_rows(
+                    t, u.size(), op,
+                    [&](IndexType idx, TScalarType &tmp)
+                    {
+                        if (!u_bitmap[idx]) return false;
+                        tmp = static_cast<TScalarType>(u_vals[idx]);
+                        return true;
+                    });
             }
 
             // =================================================================
@@ -210,20 +199,19 @@ namespace grb
 
             if (A.nvals() > 0)
             {
-                for (IndexType row_idx = 0; row_idx < A.nrows(); ++row_idx)
-                {
-                    /// @todo There is something hinky with domains here.  How
-                    /// does one perform the reduction in A domain but produce
-                    /// partial results in D3(op)?
-                    TScalarType tmp;
-
-                    if (!A[row_idx].empty())
-                    {
-                        if (reduction(tmp, A[row_idx], op)) // reduce each row
+                /// @todo There is something hinky with domains here.  How
+                /// does one perform the reduction in A domain but produce
+                /// partial results in D3(op)?
+                TScalarType tmp;
+                if (parallel_reduce_rows(
+                        tmp, A.nrows(), op,
+                        [&](IndexType row_idx, TScalarType &row_val)
                         {
-                            t = op(t, tmp); // reduce across rows
-                        }
-                    }
+                            // reduce each row
+                            return reduction(row_val, A[row_idx], op);
+                        }))
+                {
+                    t = op(t, tmp); // reduce across rows
                 }
             }
 
@@ -266,20 +254,19 @@ namespace grb
 
             if (A.nvals() > 0)
             {
-                for (IndexType row_idx = 0; row_idx < A.nrows(); ++row_idx)
-                {
-                    /// @todo There is something hinky with domains here.  How
-                    /// does one perform the reduction in A domain but produce
-                    /// partial results in D3(op)?
-                    TScalarType tmp;
-
-                    if (!A[row_idx].empty())
-                    {
-                        if (reduction(tmp, A[row_idx], op)) // reduce each row
+                /// @todo There is something hinky with domains here.  How
+                /// does one perform the reduction in A domain but produce
+                /// partial results in D3(op)?
+                TScalarType tmp;
+                if (parallel_reduce_rows(
+                        tmp, A.nrows(), op,
+                        [&](IndexType row_idx, TScalarType &row_val)
                         {
-                            t = op(t, tmp); // reduce across rows
-                        }
-                    }
+                            // reduce each row
+                            return reduction(row_val, A[row_idx], op);
+                        }))
+                {
+                    t = op(t, tmp); // reduce across rows
                 }
             }
 
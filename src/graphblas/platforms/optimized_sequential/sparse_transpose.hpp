@@ -66,29 +66,11 @@ namespace grb
             LilSparseMatrix<typename AMatrixT::ScalarType> T(ncols, nrows);
             if (A.nvals() > 0)
             {
-                for (IndexType row_idx = 0; row_idx < A.nrows(); ++row_idx)
-                {
-                    for (auto && [col_idx, val] : A[row_idx])
-                    {
-                        T[col_idx].emplace_back(row_idx, val);
-                    }
-                }
-                T.recomputeNvals();
+                parallel_transpose(T, A);
             }
             // =================================================================
-            // Accumulate T via C into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                typename AMatrixT::ScalarType,
-                decltype(accum(std::declval<typename CMatrixT::ScalarType>(),
-                               std::declval<typename AMatrixT::ScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(ncols, nrows);
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, mask, accum, outp);
         }
 
         //**********************************************************************
@@ -106,26 +88,13 @@ namespace grb
         {
             GRB_LOG_VERBOSE("C<M,z> := (A')'");
             auto const &A(AT.m_mat);
-            IndexType nrows(A.nrows());
-            IndexType ncols(A.ncols());
 
             // =================================================================
             /// Do nothing for T if A is TransposeView, Use A in next step.
 
             // =================================================================
-            // Accumulate A via C into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                typename AMatrixT::ScalarType,
-                decltype(accum(std::declval<typename CMatrixT::ScalarType>(),
-                               std::declval<typename AMatrixT::ScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(nrows, ncols);
-            ewise_or_opt_accum(Z, C, A, accum);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, A, mask, accum, outp);
         }
     }
 }
@@ -68,29 +68,77 @@ namespace grb
 
             if ((A.nvals() > 0) && (u.nvals() > 0))
             {
-                for (IndexType row_idx = 0; row_idx < u.size(); ++row_idx)
+                // Each block of output columns is scattered by one thread
+                if constexpr (is_any_pair_semiring_v<SemiringT>)
                 {
-                    if (u.hasElement(row_idx) && !A[row_idx].empty())
+                    // ANY-PAIR: union of the structures, values never read
+                    auto &t_struct(scratch_buffer<uint64_t, SCRATCH_T_STRUCT>());
+                    t_struct.resize((w.size() + BITS_PER_WORD - 1)/BITS_PER_WORD, 0UL);
+                    parallel_axpy_rows(
+                        w.size(), u, A,
+                        [&](IndexType, IndexType, auto first, auto last)
+                        {
+                            structure_axpy_packed(t_struct, first, last);
+                        });
+                    unpack_structure(t, t_struct, static_cast<TScalarType>(1));
+                }
+                else if constexpr (is_logical_bool_semiring_v<SemiringT>)
+                {
+                    // Boolean OR-AND: accumulate into packed words
+                    auto &t_struct(scratch_buffer<uint64_t, SCRATCH_T_STRUCT>());
+                    auto &t_vals(scratch_buffer<uint64_t, SCRATCH_T_VALS>());
+                    t_struct.resize((w.size() + BITS_PER_WORD - 1)/BITS_PER_WORD, 0UL);
+                    t_vals.resize(t_struct.size(), 0UL);
+                    parallel_axpy_rows(
+                        w.size(), u, A,
+                        [&](IndexType, IndexType row_idx, auto first, auto last)
+                        {
+                            or_and_axpy_packed(t_struct, t_vals,
+                                               u.extractElement(row_idx),
+                                               first, last);
+                        });
+                    unpack_bitmap(t, t_struct, t_vals);
+                }
+                else if constexpr (is_arithmetic_fp_semiring_v<SemiringT>)
+                {
+                    // PLUS-TIMES on floating point: scatter into dense t
+                    auto &t_vals(scratch_buffer<TScalarType, SCRATCH_T_VALS>());
+                    auto &t_flags(scratch_buffer<uint8_t, SCRATCH_T_FLAGS>());
+                    t_vals.resize(w.size());
+                    t_flags.resize(w.size(), 0);
+                    parallel_axpy_rows(
+                        w.size(), u, A,
+                        [&](IndexType, IndexType row_idx, auto first, auto last)
+                        {
+                            plus_times_axpy_dense(
+                                t_vals, t_flags,
+                                static_cast<TScalarType>(u.extractElement(row_idx)),
+                                first, last);
+                        });
+                    dense_to_tuples(t, t_vals, t_flags);
+                }
+                else
+                {
+                    // Per-block sparse accumulators, concatenated in order
+                    std::vector<std::vector<std::tuple<IndexType, TScalarType>>>
+                        t_parts(num_axpy_blocks(w.size()));
+                    parallel_axpy_rows(
+                        w.size(), u, A,
+                        [&](IndexType b, IndexType row_idx, auto first, auto last)
+                        {
+                            axpy(t_parts[b], op, u.extractElement(row_idx),
+                                 first, last);
+                        });
+                    for (auto &t_part : t_parts)
                     {
-                        axpy(t, op, u.extractElement(row_idx), A[row_idx]);
+                        t.insert(t.end(), t_part.begin(), t_part.end());
                     }
                 }
             }
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<typename WVectorT::ScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            std::vector<std::tuple<IndexType, ZScalarType> > z;
-            ewise_or_opt_accum_1D(z, w, t, accum);
-
-            // =================================================================
-            // Copy Z into the final output, w, considering mask and replace/merge
-            write_with_opt_mask_1D(w, z, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t, mask, accum, outp);
         }
 
         //**********************************************************************
@@ -124,34 +172,80 @@ namespace grb
 
             if ((A.nvals() > 0) && (u.nvals() > 0))
             {
-                auto u_contents(u.getContents());
-                for (IndexType row_idx = 0; row_idx < w.size(); ++row_idx)
+                // Note: the specialized semirings have commutative mult
+                if constexpr (is_any_pair_semiring_v<SemiringT>)
                 {
-                    if (!A[row_idx].empty())
-                    {
-                        TScalarType t_val;
-                        if (dot(t_val, u_contents, A[row_idx], op))
+                    // ANY-PAIR: structure only, stop at the first hit
+                    auto &u_struct(scratch_buffer<uint64_t, SCRATCH_U_STRUCT>());
+                    pack_structure(u_struct, u.get_bitmap());
+                    parallel_gather_rows(
+                        t, w.size(),
+                        [&](IndexType row_idx, auto &t_part)
                         {
-                            t.emplace_back(row_idx, t_val);
-                        }
-                    }
+                            if (structure_dot_packed(A[row_idx], u_struct))
+                            {
+                                t_part.emplace_back(row_idx, static_cast<TScalarType>(1));
+                            }
+                        });
+                }
+                else if constexpr (is_logical_bool_semiring_v<SemiringT>)
+                {
+                    // Boolean OR-AND: test u's packed structure/values
+                    auto &u_struct(scratch_buffer<uint64_t, SCRATCH_U_STRUCT>());
+                    auto &u_vals(scratch_buffer<uint64_t, SCRATCH_U_VALS>());
+                    pack_bitmap(u_struct, u_vals, u.get_bitmap(), u.get_vals());
+                    parallel_gather_rows(
+                        t, w.size(),
+                        [&](IndexType row_idx, auto &t_part)
+                        {
+                            bool t_val;
+                            if (!A[row_idx].empty() &&
+                                or_and_dot_packed(t_val, A[row_idx], u_struct, u_vals))
+                            {
+                                t_part.emplace_back(row_idx, t_val);
+                            }
+                        });
+                }
+                else if constexpr (is_arithmetic_fp_semiring_v<SemiringT>)
+                {
+                    // PLUS-TIMES on floating point: gather from dense u
+                    auto &u_flags(scratch_buffer<uint8_t, SCRATCH_U_FLAGS>());
+                    unpack_flags(u_flags, u.get_bitmap());
+                    parallel_gather_rows(
+                        t, w.size(),
+                        [&](IndexType row_idx, auto &t_part)
+                        {
+                            TScalarType t_val;
+                            if (!A[row_idx].empty() &&
+                                plus_times_dot_dense(t_val, A[row_idx],
+                                                     u_flags, u.get_vals()))
+                            {
+                                t_part.emplace_back(row_idx, t_val);
+                            }
+                        });
+                }
+                else
+                {
+                    auto u_contents(u.getContents());
+                    parallel_gather_rows(
+                        t, w.size(),
+                        [&](IndexType row_idx, auto &t_part)
+                        {
+                            if (!A[row_idx].empty())
+                            {
+                                TScalarType t_val;
+                                if (dot(t_val, u_contents, A[row_idx], op))
+                                {
+                                    t_part.emplace_back(row_idx, t_val);
+                                }
+                            }
+                        });
                 }
             }
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<typename WVectorT::ScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            std::vector<std::tuple<IndexType, ZScalarType> > z;
-            ewise_or_opt_accum_1D(z, w, t, accum);
-
-            // =================================================================
-            // Copy Z into the final output, w, considering mask and replace/merge
-            write_with_opt_mask_1D(w, z, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t, mask, accum, outp);
         }
 
     } // backend
@@ -41,6 +41,7 @@
 
 // Add individual operation files here
 #include <graphblas/platforms/sequential/sparse_mxm.hpp>
+#include <graphblas/platforms/sequential/sparse_mxm_reduce.hpp>
 #include <graphblas/platforms/sequential/sparse_mxv.hpp>
 #include <graphblas/platforms/sequential/sparse_vxm.hpp>
 #include <graphblas/platforms/sequential/sparse_ewisemult.hpp>
@@ -48,6 +49,7 @@
 #include <graphblas/platforms/sequential/sparse_extract.hpp>
 #include <graphblas/platforms/sequential/sparse_assign.hpp>
 #include <graphblas/platforms/sequential/sparse_apply.hpp>
+#include <graphblas/platforms/sequential/sparse_select.hpp>
 #include <graphblas/platforms/sequential/sparse_reduce.hpp>
 #include <graphblas/platforms/sequential/sparse_transpose.hpp>
 #include <graphblas/platforms/sequential/sparse_kronecker.hpp>
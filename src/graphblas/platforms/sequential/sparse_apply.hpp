@@ -70,29 +70,26 @@ namespace grb
 
             if (u.nvals() > 0)
             {
-                for (auto&& [idx, val] : u.getContents()) {
-                    t_contents.emplace_back(idx, op(val));
+                // With a mask, only compute the entries it allows
+                if constexpr (std::is_same_v<MaskT, NoMask>)
+                {
+                    for (auto&& [idx, val] : u.getContents()) {
+                        t_contents.emplace_back(idx, op(val));
+                    }
+                }
+                else
+                {
+                    masked_transform_1D(
+                        t_contents, u, mask,
+                        [&](auto const &val) { return op(val); });
                 }
             }
 
             GRB_LOG_VERBOSE("t: " << t_contents);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<WScalarT>(),
-                               std::declval<TScalarType>()))>;
-
-            std::vector<std::tuple<IndexType,ZScalarType> > z_contents;
-            ewise_or_opt_accum_1D(z_contents, w, t_contents, accum);
-
-            GRB_LOG_VERBOSE("z: " << z_contents);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask_1D(w, z_contents, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t_contents, mask, accum, outp);
         }
 
         //**********************************************************************
@@ -121,11 +118,24 @@ namespace grb
             using TScalarType = decltype(op(std::declval<AScalarType>()));
             LilSparseMatrix<TScalarType> T(nrows, ncols);
 
+#pragma omp parallel for schedule(dynamic, 64)
             for (IndexType row_idx = 0; row_idx < A.nrows(); ++row_idx)
             {
-                for (auto&& [a_idx, a_val] : A[row_idx])
+                // With a mask, only compute the entries it allows
+                if constexpr (std::is_same_v<MaskT, NoMask>)
+                {
+                    for (auto&& [a_idx, a_val] : A[row_idx])
+                    {
+                        T[row_idx].emplace_back(a_idx, op(a_val));
+                    }
+                }
+                else
                 {
-                    T[row_idx].emplace_back(a_idx, op(a_val));
+                    masked_transform(
+                        T[row_idx], A[row_idx], get_mask_matrix(Mask)[row_idx],
+                        mask_structure_flag_v<MaskT>,
+                        mask_complement_flag_v<MaskT>,
+                        [&](auto const &a_val) { return op(a_val); });
                 }
             }
             T.recomputeNvals();
@@ -133,21 +143,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate T via C into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarT>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(nrows, ncols);
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
         }
 
         //**********************************************************************
@@ -189,21 +186,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate T via C into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarT>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(ncols, nrows);
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
         }
 
         //**********************************************************************
@@ -236,29 +220,26 @@ namespace grb
 
             if (u.nvals() > 0)
             {
-                for (auto&& [idx, u_val] : u.getContents()) {
-                    t_contents.emplace_back(idx, op(val, u_val));
+                // With a mask, only compute the entries it allows
+                if constexpr (std::is_same_v<MaskT, NoMask>)
+                {
+                    for (auto&& [idx, u_val] : u.getContents()) {
+                        t_contents.emplace_back(idx, op(val, u_val));
+                    }
+                }
+                else
+                {
+                    masked_transform_1D(
+                        t_contents, u, mask,
+                        [&](auto const &u_val) { return op(val, u_val); });
                 }
             }
 
             GRB_LOG_VERBOSE("t: " << t_contents);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<WScalarT>(),
-                               std::declval<TScalarType>()))>;
-
-            std::vector<std::tuple<IndexType,ZScalarType> > z_contents;
-            ewise_or_opt_accum_1D(z_contents, w, t_contents, accum);
-
-            GRB_LOG_VERBOSE("z: " << z_contents);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask_1D(w, z_contents, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t_contents, mask, accum, outp);
         }
 
         //**********************************************************************
@@ -292,30 +273,26 @@ namespace grb
 
             if (u.nvals() > 0)
             {
-                for (auto&& [idx, u_val] : u.getContents()) {
-                    t_contents.emplace_back(idx, op(u_val, val));
+                // With a mask, only compute the entries it allows
+                if constexpr (std::is_same_v<MaskT, NoMask>)
+                {
+                    for (auto&& [idx, u_val] : u.getContents()) {
+                        t_contents.emplace_back(idx, op(u_val, val));
+                    }
+                }
+                else
+                {
+                    masked_transform_1D(
+                        t_contents, u, mask,
+                        [&](auto const &u_val) { return op(u_val, val); });
                 }
             }
 
             GRB_LOG_VERBOSE("t: " << t_contents);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<WScalarT>(),
-                               std::declval<TScalarType>()))>;
-
-
-            std::vector<std::tuple<IndexType,ZScalarType> > z_contents;
-            ewise_or_opt_accum_1D(z_contents, w, t_contents, accum);
-
-            GRB_LOG_VERBOSE("z: " << z_contents);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask_1D(w, z_contents, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t_contents, mask, accum, outp);
         }
 
 
@@ -350,11 +327,24 @@ namespace grb
                                             std::declval<AScalarType>()));
             LilSparseMatrix<TScalarType> T(nrows, ncols);
 
+#pragma omp parallel for schedule(dynamic, 64)
             for (IndexType row_idx = 0; row_idx < A.nrows(); ++row_idx)
             {
-                for (auto&& [a_idx, a_val] : A[row_idx])
+                // With a mask, only compute the entries it allows
+                if constexpr (std::is_same_v<MaskT, NoMask>)
+                {
+                    for (auto&& [a_idx, a_val] : A[row_idx])
+                    {
+                        T[row_idx].emplace_back(a_idx, op(val, a_val));
+                    }
+                }
+                else
                 {
-                    T[row_idx].emplace_back(a_idx, op(val, a_val));
+                    masked_transform(
+                        T[row_idx], A[row_idx], get_mask_matrix(Mask)[row_idx],
+                        mask_structure_flag_v<MaskT>,
+                        mask_complement_flag_v<MaskT>,
+                        [&](auto const &a_val) { return op(val, a_val); });
                 }
             }
             T.recomputeNvals();
@@ -362,21 +352,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate T via C into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarT>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(nrows, ncols);
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
         }
 
         //**********************************************************************
@@ -423,21 +400,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate T via C into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarT>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(ncols, nrows);
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
         }
 
 
@@ -473,11 +437,24 @@ namespace grb
                                             std::declval<ValueT>()));
             LilSparseMatrix<TScalarType> T(nrows, ncols);
 
+#pragma omp parallel for schedule(dynamic, 64)
             for (IndexType row_idx = 0; row_idx < A.nrows(); ++row_idx)
             {
-                for (auto&& [a_idx, a_val] : A[row_idx])
+                // With a mask, only compute the entries it allows
+                if constexpr (std::is_same_v<MaskT, NoMask>)
+                {
+                    for (auto&& [a_idx, a_val] : A[row_idx])
+                    {
+                        T[row_idx].emplace_back(a_idx, op(a_val, val));
+                    }
+                }
+                else
                 {
-                    T[row_idx].emplace_back(a_idx, op(a_val, val));
+                    masked_transform(
+                        T[row_idx], A[row_idx], get_mask_matrix(Mask)[row_idx],
+                        mask_structure_flag_v<MaskT>,
+                        mask_complement_flag_v<MaskT>,
+                        [&](auto const &a_val) { return op(a_val, val); });
                 }
             }
             T.recomputeNvals();
@@ -485,21 +462,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate T via C into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarT>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(nrows, ncols);
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
         }
 
 
@@ -548,21 +512,148 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate T via C into Z
-            using ZScalarType = std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarT>(),
-                               std::declval<TScalarType>()))>;
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
+        }
+
+        //**********************************************************************
+        // Implementation of Apply with an index-unary operator:
+        // w<m,z> := op(u(i), i, 0)
+        template<typename WScalarT,
+                 typename MaskT,
+                 typename AccumT,
+                 typename IndexUnaryOpT,
+                 typename UVectorT,
+                 typename ...WTagsT>
+        inline void apply_index(
+            grb::backend::Vector<WScalarT, WTagsT...>       &w,
+            MaskT                                     const &mask,
+            AccumT                                    const &accum,
+            IndexUnaryOpT                                    op,
+            UVectorT                                  const &u,
+            OutputControlEnum                                outp)
+        {
+            GRB_LOG_VERBOSE("w<m,z> := op(u,i,0)");
+            // =================================================================
+            // Apply the index-unary operator from u into t (one pass over
+            // u's bitmap).
+            using UScalarType = typename UVectorT::ScalarType;
+            using TScalarType = decltype(op(std::declval<UScalarType>(),
+                                            IndexType(), IndexType()));
+            std::vector<std::tuple<IndexType,TScalarType> > t_contents;
+
+            if (u.nvals() > 0)
+            {
+                auto const &u_bits(u.get_bitmap());
+                auto const &u_vals(u.get_vals());
+                t_contents.reserve(u.nvals());
+                for (IndexType idx = 0; idx < u.size(); ++idx)
+                {
+                    if (u_bits[idx])
+                    {
+                        t_contents.emplace_back(idx, op(u_vals[idx], idx, 0));
+                    }
+                }
+            }
+
+            GRB_LOG_VERBOSE("t: " << t_contents);
+
+            // =================================================================
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t_contents, mask, accum, outp);
+        }
+
+        //**********************************************************************
+        // Implementation of Apply with an index-unary operator:
+        // C<M,z> := op(A(i,j), i, j)
+        template<typename CScalarT,
+                 typename MaskT,
+                 typename AccumT,
+                 typename IndexUnaryOpT,
+                 typename AMatrixT,
+                 typename ...CTagsT>
+        inline void apply_index(
+            grb::backend::Matrix<CScalarT, CTagsT...>       &C,
+            MaskT                                     const &Mask,
+            AccumT                                    const &accum,
+            IndexUnaryOpT                                    op,
+            AMatrixT                                  const &A,
+            OutputControlEnum                                outp)
+        {
+            GRB_LOG_VERBOSE("C<M,z> := op(A,i,j)");
+            IndexType nrows(A.nrows());
+            IndexType ncols(A.ncols());
+
+            // =================================================================
+            // Apply the index-unary operator from A into T.
+            using AScalarType = typename AMatrixT::ScalarType;
+            using TScalarType = decltype(op(std::declval<AScalarType>(),
+                                            IndexType(), IndexType()));
+            LilSparseMatrix<TScalarType> T(nrows, ncols);
+
+#pragma omp parallel for schedule(dynamic, 64)
+            for (IndexType row_idx = 0; row_idx < nrows; ++row_idx)
+            {
+                T[row_idx].reserve(A[row_idx].size());
+                for (auto&& [a_idx, a_val] : A[row_idx])
+                {
+                    T[row_idx].emplace_back(a_idx, op(a_val, row_idx, a_idx));
+                }
+            }
+            T.recomputeNvals();
+
+            GRB_LOG_VERBOSE("T: " << T);
+
+            // =================================================================
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
+        }
 
-            LilSparseMatrix<ZScalarType> Z(ncols, nrows);
-            ewise_or_opt_accum(Z, C, T, accum);
+        //**********************************************************************
+        // Implementation of Apply with an index-unary operator:
+        // C<M,z> := op(A'(i,j), i, j)
+        // The operator sees the indices of the transposed matrix.
+        template<typename CScalarT,
+                 typename MaskT,
+                 typename AccumT,
+                 typename IndexUnaryOpT,
+                 typename AMatrixT,
+                 typename ...CTagsT>
+        inline void apply_index(
+            grb::backend::Matrix<CScalarT, CTagsT...>       &C,
+            MaskT                                     const &Mask,
+            AccumT                                    const &accum,
+            IndexUnaryOpT                                    op,
+            TransposeView<AMatrixT>                   const &AT,
+            OutputControlEnum                                outp)
+        {
+            GRB_LOG_VERBOSE("C<M,z> := op(A',i,j)");
+            auto const &A(AT.m_mat);
+            IndexType nrows(A.nrows());
+            IndexType ncols(A.ncols());
+
+            // =================================================================
+            // Apply the index-unary operator from A' into T.
+            using AScalarType = typename AMatrixT::ScalarType;
+            using TScalarType = decltype(op(std::declval<AScalarType>(),
+                                            IndexType(), IndexType()));
+            LilSparseMatrix<TScalarType> T(ncols, nrows);
 
-            GRB_LOG_VERBOSE("Z: " << Z);
+            for (IndexType row_idx = 0; row_idx < nrows; ++row_idx)
+            {
+                for (auto&& [a_idx, a_val] : A[row_idx])
+                {
+                    T[a_idx].emplace_back(row_idx,
+                                          op(a_val, a_idx, row_idx)); // idx's swapped
+                }
+            }
+            T.recomputeNvals();
+
+            GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
         }
     }
 }
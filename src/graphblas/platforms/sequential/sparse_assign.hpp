@@ -161,23 +161,39 @@ namespace grb
             std::vector<std::tuple<IndexType, IndexType>> oi_pairs;
             compute_outin_mapping(col_Indices, oi_pairs);
 
-            // Walk the input rows (in order specified by input)
+            // Pair each output row with the (non-empty) input row that lands
+            // on it.  When an output row is repeated the last input row wins,
+            // so keep only that one; every output row is then written by one
+            // iteration.
+            std::vector<std::tuple<IndexType, IndexType>> oi_row_pairs;
             for (IndexType in_row_index = 0;
                  in_row_index < row_Indices.size();
                  ++in_row_index)
             {
                 if (!A[in_row_index].empty())
                 {
-                    IndexType out_row_index = row_Indices[in_row_index];
-                    std::vector<std::tuple<IndexType,TScalarT> > out_row;
-
-                    // Extract the values from the row
-                    vectorExpand(out_row, A[in_row_index], oi_pairs);
-
-                    if (!out_row.empty())
-                        T.setRow(out_row_index, out_row);
+                    oi_row_pairs.emplace_back(row_Indices[in_row_index],
+                                              in_row_index);
                 }
             }
+            std::sort(oi_row_pairs.begin(), oi_row_pairs.end());
+            auto last_of_each = std::unique(
+                oi_row_pairs.rbegin(), oi_row_pairs.rend(),
+                [](auto const &a, auto const &b)
+                { return std::get<0>(a) == std::get<0>(b); });
+            oi_row_pairs.erase(oi_row_pairs.begin(), last_of_each.base());
+
+            // Walk the output rows
+            IndexType num_rows(oi_row_pairs.size());
+#pragma omp parallel for schedule(dynamic, 64)
+            for (IndexType idx = 0; idx < num_rows; ++idx)
+            {
+                auto [out_row_index, in_row_index] = oi_row_pairs[idx];
+
+                // Extract the values from the row
+                vectorExpand(T[out_row_index], A[in_row_index], oi_pairs);
+            }
+            T.recomputeNvals();
         }
 
         //********************************************************************
@@ -192,28 +208,12 @@ namespace grb
                           ColSequenceT               const &col_Indices) // of AT
         {
             auto const &A(AT.m_mat);
-            T.clear();
-
-            // Build the mapping pairs once up front (rows of AT -> cols of T)
-            std::vector<std::tuple<IndexType, IndexType>> oi_col_pairs;
-            std::vector<std::tuple<IndexType, IndexType>> oi_row_pairs;
-            compute_outin_mapping(col_Indices, oi_col_pairs);
-            compute_outin_mapping(row_Indices, oi_row_pairs);
-
-            std::vector<std::tuple<IndexType,TScalarT> > out_col;
-
-            // Walk the input columns (rows of A) in ascending output order
-            for (auto&& [out_col_index, in_col_index] : oi_col_pairs)
-            {
-                // Extract the values from the row and set col (push_back on rows)
-                vectorExpand(out_col, A[in_col_index], oi_row_pairs);
 
-                for (auto&& [out_row_index, val] : out_col)
-                {
-                    T[out_row_index].emplace_back(out_col_index, val);
-                }
-            }
-            T.recomputeNvals();
+            // T' is the expansion of A with the roles of the index
+            // sequences swapped; build it row-parallel and transpose it.
+            LilSparseMatrix<TScalarT> TT(T.ncols(), T.nrows());
+            matrixExpand(TT, A, col_Indices, row_Indices);
+            parallel_transpose(T, TT);
         }
 
         //********************************************************************
@@ -225,21 +225,32 @@ namespace grb
                             ColIteratorT                        col_begin,
                             ColIteratorT                        col_end)
         {
+            // Every assigned row gets the same contents
             std::vector<std::tuple<IndexType,ValueT> > out_row;
+            for (auto col_it = col_begin; col_it != col_end; ++col_it)
+            {
+                // @todo: add bounds check
+                out_row.emplace_back(*col_it, value);
+            }
+            if (out_row.empty()) return;
 
+            // Repeated rows would be written twice, so drop duplicates
+            std::vector<IndexType> rows;
             for (auto row_it = row_begin; row_it != row_end; ++row_it)
             {
-                out_row.clear();
-                for (auto col_it = col_begin; col_it != col_end; ++col_it)
-                {
-                    // @todo: add bounds check
-                    out_row.emplace_back(*col_it, value);
-                }
+                rows.push_back(*row_it);
+            }
+            std::sort(rows.begin(), rows.end());
+            rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
 
-                // @todo: add bounds check
-                if (!out_row.empty())
-                    T.setRow(*row_it, out_row);
+            // @todo: add bounds check
+            IndexType num_rows(rows.size());
+#pragma omp parallel for schedule(static)
+            for (IndexType idx = 0; idx < num_rows; ++idx)
+            {
+                T[rows[idx]] = out_row;
             }
+            T.recomputeNvals();
         }
 
         //********************************************************************
@@ -121,14 +121,22 @@ namespace grb
             std::vector<std::tuple<IndexType,CScalarT> > out_row;
             C.clear();
 
-            // Walk the rows
-            IndexType out_row_index = 0;
+            // Gather the source rows so the output rows can be split
+            // across threads
+            std::vector<IndexType> in_rows;
+            for (auto row_it = row_begin; row_it != row_end; ++row_it)
+            {
+                in_rows.push_back(*row_it);
+            }
 
-            for (auto row_it = row_begin;
-                 row_it != row_end;
-                 ++row_it, ++out_row_index)
+            // Walk the rows
+            IndexType num_out_rows(in_rows.size());
+#pragma omp parallel for schedule(dynamic, 64) private(out_row)
+            for (IndexType out_row_index = 0;
+                 out_row_index < num_out_rows;
+                 ++out_row_index)
             {
-                auto row(A[*row_it]);
+                auto row(A[in_rows[out_row_index]]);
 
                 // Extract the values from the row
                 vectorExtract(out_row, row, col_begin, col_end);
@@ -337,21 +345,8 @@ namespace grb
             GRB_LOG_VERBOSE("t: " << t);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                UScalarType,
-                decltype(accum(std::declval<typename WVectorT::ScalarType>(),
-                               std::declval<UScalarType>()))>;
-
-            std::vector<std::tuple<IndexType, ZScalarType> > z;
-            ewise_or_opt_accum_1D(z, w, t, accum);
-
-            GRB_LOG_VERBOSE("z: " << z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask_1D(w, z, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t, mask, accum, outp);
 
             GRB_LOG_VERBOSE("w (Result): " << w);
         };
@@ -396,21 +391,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                AScalarType,
-                decltype(accum(std::declval<typename CMatrixT::ScalarType>(),
-                               std::declval<AScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(C.nrows(), C.ncols());
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, Mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
 
             GRB_LOG_VERBOSE("C (Result): " << C);
         };
@@ -453,21 +435,8 @@ namespace grb
             GRB_LOG_VERBOSE("t: " << t);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                AScalarType,
-                decltype(accum(std::declval<typename WVectorT::ScalarType>(),
-                               std::declval<AScalarType>()))>;
-
-            std::vector<std::tuple<IndexType, ZScalarType> > z;
-            ewise_or_opt_accum_1D(z, w, t, accum);
-
-            GRB_LOG_VERBOSE("z: " << z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask_1D(w, z, mask, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t, mask, accum, outp);
 
             GRB_LOG_VERBOSE("w (Result): " << w);
         }
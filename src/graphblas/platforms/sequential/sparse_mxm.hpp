@@ -67,7 +67,6 @@ namespace grb
         {
             GRB_LOG_VERBOSE("C<M,z> := (A*B)");
 
-            using CScalarType = typename CMatrixT::ScalarType;
 
             // =================================================================
             // Do the axpy work with the semiring.
@@ -75,37 +74,23 @@ namespace grb
             LilSparseMatrix<TScalarType> T(C.nrows(), C.ncols());
 
             typename LilSparseMatrix<TScalarType>::RowType T_row;
+            std::vector<PackedRowType> B_packed;
+            prepare_row_product<SemiringT>(B_packed, B);
 
             for (IndexType i = 0; i < A.nrows(); ++i)
             {
-                for (auto&& [k, a_ik] : A[i])
-                {
-                    if (B[k].empty()) continue;
+                if (A[i].empty()) continue;
 
-                    // T[i] += (a_ik*B[k])  // must reduce in D3
-                    axpy(T[i], op, a_ik, B[k]);
-                }
+                // T[i] = A[i] +.* B
+                row_product(T_row, op, A[i], B, B_packed);
+                T.setRow(i, T_row);
             }
 
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(C.nrows(), C.ncols());
-
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, M, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, M, accum, outp);
         } // mxm
 
         //**********************************************************************
@@ -128,7 +113,6 @@ namespace grb
             GRB_LOG_VERBOSE("C<M,z> := (A'*B)");
             auto const &A(AT.m_mat);
 
-            using CScalarType = typename CMatrixT::ScalarType;
 
             // =================================================================
             // Do the basic axpy work with the semiring.
@@ -149,22 +133,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(C.nrows(), C.ncols());
-
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, M, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, M, accum, outp);
         } // mxm
 
         //**********************************************************************
@@ -191,7 +161,6 @@ namespace grb
             IndexType nrow_A(A.nrows());
             IndexType nrow_B(B.nrows());
 
-            using CScalarType = typename CMatrixT::ScalarType;
 
             // =================================================================
             // Do the basic dot-product work with the semiring.
@@ -225,22 +194,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(C.nrows(), C.ncols());
-
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, M, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, M, accum, outp);
         } // mxm
 
         //**********************************************************************
@@ -297,22 +252,8 @@ namespace grb
             GRB_LOG_VERBOSE("T: " << T);
 
             // =================================================================
-            // Accumulate into Z
-            using ZScalarType = typename std::conditional_t<
-                std::is_same_v<AccumT, NoAccumulate>,
-                TScalarType,
-                decltype(accum(std::declval<CScalarType>(),
-                               std::declval<TScalarType>()))>;
-
-            LilSparseMatrix<ZScalarType> Z(C.nrows(), C.ncols());
-
-            ewise_or_opt_accum(Z, C, T, accum);
-
-            GRB_LOG_VERBOSE("Z: " << Z);
-
-            // =================================================================
-            // Copy Z into the final output considering mask and replace/merge
-            write_with_opt_mask(C, Z, M, outp);
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, M, accum, outp);
         } // mxm
 
     } // backend
@@ -0,0 +1,179 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * DM20-0442
+ */
+
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <vector>
+#include <iterator>
+#include <iostream>
+#include <graphblas/types.hpp>
+#include <graphblas/exceptions.hpp>
+#include <graphblas/algebra.hpp>
+
+#include "sparse_helpers.hpp"
+#include "LilSparseMatrix.hpp"
+
+//******************************************************************************
+
+namespace grb
+{
+    namespace backend
+    {
+        //**********************************************************************
+        // Implementation of vector variant of Select: w<m,z> := u(op(u,i,0))
+        template<typename WScalarT,
+                 typename MaskT,
+                 typename AccumT,
+                 typename IndexUnaryOpT,
+                 typename UVectorT,
+                 typename ...WTagsT>
+        inline void select(
+            grb::backend::Vector<WScalarT, WTagsT...>       &w,
+            MaskT                                     const &mask,
+            AccumT                                    const &accum,
+            IndexUnaryOpT                                    op,
+            UVectorT                                  const &u,
+            OutputControlEnum                                outp)
+        {
+            GRB_LOG_VERBOSE("w<m,z> := u(op(u,i,0))");
+            // =================================================================
+            // Keep the elements of u that satisfy the predicate in t.
+            using TScalarType = typename UVectorT::ScalarType;
+            std::vector<std::tuple<IndexType,TScalarType> > t_contents;
+
+            if (u.nvals() > 0)
+            {
+                for (auto&& [idx, val] : u.getContents())
+                {
+                    if (op(val, idx, 0))
+                    {
+                        t_contents.emplace_back(idx, val);
+                    }
+                }
+            }
+
+            GRB_LOG_VERBOSE("t: " << t_contents);
+
+            // =================================================================
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask_1D(w, t_contents, mask, accum, outp);
+        }
+
+        //**********************************************************************
+        // Implementation of matrix variant of Select: C<M,z> := A(op(A,i,j))
+        template<typename CScalarT,
+                 typename MaskT,
+                 typename AccumT,
+                 typename IndexUnaryOpT,
+                 typename AMatrixT,
+                 typename ...CTagsT>
+        inline void select(
+            grb::backend::Matrix<CScalarT, CTagsT...>       &C,
+            MaskT                                     const &Mask,
+            AccumT                                    const &accum,
+            IndexUnaryOpT                                    op,
+            AMatrixT                                  const &A,
+            OutputControlEnum                                outp)
+        {
+            GRB_LOG_VERBOSE("C<M,z> := A(op(A,i,j))");
+            IndexType nrows(A.nrows());
+            IndexType ncols(A.ncols());
+
+            // =================================================================
+            // Keep the stored values of A that satisfy the predicate in T.
+            using TScalarType = typename AMatrixT::ScalarType;
+            LilSparseMatrix<TScalarType> T(nrows, ncols);
+
+#pragma omp parallel for schedule(dynamic, 64)
+            for (IndexType row_idx = 0; row_idx < nrows; ++row_idx)
+            {
+                for (auto&& [a_idx, a_val] : A[row_idx])
+                {
+                    if (op(a_val, row_idx, a_idx))
+                    {
+                        T[row_idx].emplace_back(a_idx, a_val);
+                    }
+                }
+            }
+            T.recomputeNvals();
+
+            GRB_LOG_VERBOSE("T: " << T);
+
+            // =================================================================
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
+        }
+
+        //**********************************************************************
+        // Implementation of matrix variant of Select: C<M,z> := A'(op(A',i,j))
+        // The predicate sees the indices of the transposed matrix.
+        template<typename CScalarT,
+                 typename MaskT,
+                 typename AccumT,
+                 typename IndexUnaryOpT,
+                 typename AMatrixT,
+                 typename ...CTagsT>
+        inline void select(
+            grb::backend::Matrix<CScalarT, CTagsT...>       &C,
+            MaskT                                     const &Mask,
+            AccumT                                    const &accum,
+            IndexUnaryOpT                                    op,
+            TransposeView<AMatrixT>                   const &AT,
+            OutputControlEnum                                outp)
+        {
+            GRB_LOG_VERBOSE("C<M,z> := A'(op(A',i,j))");
+            auto const &A(AT.m_mat);
+            IndexType nrows(A.nrows());
+            IndexType ncols(A.ncols());
+
+            // =================================================================
+            // Keep the stored values of A' that satisfy the predicate in T.
+            using TScalarType = typename AMatrixT::ScalarType;
+            LilSparseMatrix<TScalarType> T(ncols, nrows);
+
+            for (IndexType row_idx = 0; row_idx < nrows; ++row_idx)
+            {
+                for (auto&& [a_idx, a_val] : A[row_idx])
+                {
+                    if (op(a_val, a_idx, row_idx)) // idx's swapped
+                    {
+                        T[a_idx].emplace_back(row_idx, a_val);
+                    }
+                }
+            }
+            T.recomputeNvals();
+
+            GRB_LOG_VERBOSE("T: " << T);
+
+            // =================================================================
+            // Accumulate into the output considering mask and replace/merge
+            write_with_opt_accum_mask(C, T, Mask, accum, outp);
+        }
+    }
+}
@@ -471,4 +471,33 @@ BOOST_AUTO_TEST_CASE(logical_xnor_monoid_test)
     BOOST_CHECK_EQUAL(LogicalXnorMonoid<bool>()(true, true),  true);
 }
 
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(terminal_monoid_test)
+{
+    BOOST_CHECK(has_terminal_v<LogicalOrMonoid<bool>>);
+    BOOST_CHECK(has_terminal_v<LogicalAndMonoid<bool>>);
+    BOOST_CHECK(has_terminal_v<MinMonoid<uint32_t>>);
+    BOOST_CHECK(has_terminal_v<MaxMonoid<int16_t>>);
+    BOOST_CHECK(!has_terminal_v<PlusMonoid<int>>);
+    BOOST_CHECK(!has_terminal_v<MinMonoid<double>>);
+    BOOST_CHECK(!has_terminal_v<Plus<int>>);
+
+    BOOST_CHECK_EQUAL(LogicalOrMonoid<bool>().terminal(),  true);
+    BOOST_CHECK_EQUAL(LogicalAndMonoid<bool>().terminal(), false);
+    BOOST_CHECK_EQUAL(MinMonoid<uint32_t>().terminal(), 0U);
+    BOOST_CHECK_EQUAL(MaxMonoid<uint8_t>().terminal(), 255U);
+    BOOST_CHECK_EQUAL(MinMonoid<int8_t>().terminal(), -128);
+
+    // semirings inherit the terminal value of their additive monoid
+    BOOST_CHECK(has_terminal_v<LogicalSemiring<bool>>);
+    BOOST_CHECK(has_terminal_v<MinPlusSemiring<uint64_t>>);
+    BOOST_CHECK(!has_terminal_v<ArithmeticSemiring<double>>);
+
+    BOOST_CHECK(is_terminal(LogicalSemiring<bool>(), true));
+    BOOST_CHECK(!is_terminal(LogicalSemiring<bool>(), false));
+    BOOST_CHECK(is_terminal(MinMonoid<uint32_t>(), 0U));
+    BOOST_CHECK(!is_terminal(PlusMonoid<int>(), 0));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1189,4 +1189,29 @@ BOOST_AUTO_TEST_CASE(max_second_test)
     BOOST_CHECK_EQUAL(MaxSecondSemiring<bool>().mult(true, false), false);
 }
 
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(any_pair_semiring_test)
+{
+    BOOST_CHECK_EQUAL(Pair<double>()(0.0, 3.5), 1.0);
+    BOOST_CHECK_EQUAL((Pair<double, int, uint8_t>()(-1.0, 0)), 1U);
+
+    BOOST_CHECK_EQUAL(AnyMonoid<int>().identity(), 0);
+    BOOST_CHECK_EQUAL(AnyMonoid<int>()(3, 4), 3);
+    BOOST_CHECK(is_terminal(AnyMonoid<int>(), 42));
+
+    BOOST_CHECK_EQUAL(AnyPairSemiring<float>().zero(), 0.0f);
+    BOOST_CHECK_EQUAL(AnyPairSemiring<float>().mult(0.0f, -2.5f), 1.0f);
+    BOOST_CHECK_EQUAL(AnyFirstSemiring<int>().mult(5, 7), 5);
+    BOOST_CHECK_EQUAL(AnySecondSemiring<int>().mult(5, 7), 7);
+    BOOST_CHECK_EQUAL(PlusPairSemiring<int>().add(2, 1), 3);
+    BOOST_CHECK_EQUAL(PlusPairSemiring<int>().mult(5, 7), 1);
+
+    BOOST_CHECK(is_any_pair_semiring_v<AnyPairSemiring<bool>>);
+    BOOST_CHECK(!is_any_pair_semiring_v<AnyFirstSemiring<bool>>);
+    BOOST_CHECK(!is_any_pair_semiring_v<PlusPairSemiring<bool>>);
+    BOOST_CHECK(is_any_semiring_v<AnySecondSemiring<int>>);
+    BOOST_CHECK(has_terminal_v<AnyFirstSemiring<double>>);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
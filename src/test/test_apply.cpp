@@ -2073,4 +2073,198 @@ BOOST_AUTO_TEST_CASE(bind_apply_stdvec_test_plus_accum)
 }
 
 
+//****************************************************************************
+// apply with index-unary operators
+//****************************************************************************
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(apply_index_unary_vector)
+{
+    std::vector<double> u_dense = {8, 0, 6, 0, 4};
+    Vector<double> u(u_dense, 0.);
+
+    std::vector<IndexType> ans_dense = {0, 0, 2, 0, 4};
+    Vector<IndexType> answer(ans_dense, 0);
+    answer.setElement(0, 0);   // explicit zero at index 0
+
+    Vector<IndexType> w(5);
+    apply(w, NoMask(), NoAccumulate(), RowIndex<IndexType>(), u);
+    BOOST_CHECK_EQUAL(w, answer);
+
+    // thunk is added, and in place works
+    std::vector<IndexType> ans2_dense = {10, 0, 12, 0, 14};
+    Vector<IndexType> answer2(ans2_dense, 0);
+    apply(w, NoMask(), NoAccumulate(), RowIndex<IndexType>(10), w);
+    BOOST_CHECK_EQUAL(w, answer2);
+
+    // user lambda (value, i, j) with a mask and accumulator
+    std::vector<bool> m_dense = {true, false, true, false, false};
+    Vector<bool> m(m_dense, false);
+    std::vector<double> w3_dense = {1, 1, 1, 1, 1};
+    Vector<double> w3(w3_dense);
+    std::vector<double> ans3_dense = {9, 1, 9, 1, 1};
+    Vector<double> answer3(ans3_dense);
+    apply(w3, m, Plus<double>(),
+          [](double v, IndexType i, IndexType) { return v + i; }, u);
+    BOOST_CHECK_EQUAL(w3, answer3);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(apply_index_unary_matrix)
+{
+    // | 1 1 - - |
+    // | 1 2 2 - |
+    // | - 2 3 3 |
+    IndexArrayType      i = {0, 0, 1, 1, 1, 2, 2, 2};
+    IndexArrayType      j = {0, 1, 0, 1, 2, 1, 2, 3};
+    std::vector<double> v = {1, 1, 1, 2, 2, 2, 3, 3};
+    Matrix<double> A(3, 4);
+    A.build(i, j, v);
+
+    {
+        std::vector<IndexType> ans_v = {0, 1, 0, 1, 2, 1, 2, 3};
+        Matrix<IndexType> answer(3, 4);
+        answer.build(i, j, ans_v);
+
+        Matrix<IndexType> C(3, 4);
+        apply(C, NoMask(), NoAccumulate(), ColIndex<IndexType>(), A);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+    {
+        std::vector<int64_t> ans_v = {0, 1, -1, 0, 1, -1, 0, 1};
+        Matrix<int64_t> answer(3, 4);
+        answer.build(i, j, ans_v);
+
+        Matrix<int64_t> C(3, 4);
+        apply(C, NoMask(), NoAccumulate(), DiagIndex<>(), A);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+    {
+        // op sees the indices of A'
+        std::vector<IndexType> ans_v = {0, 1, 0, 1, 2, 1, 2, 3};
+        Matrix<IndexType> answer(4, 3);
+        answer.build(j, i, ans_v);
+
+        Matrix<IndexType> C(4, 3);
+        apply(C, NoMask(), NoAccumulate(), RowIndex<IndexType>(),
+              transpose(A));
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+    {
+        // value and location together, structural complement mask
+        std::vector<std::vector<bool>> M_dense = {{1, 1, 1, 1},
+                                                  {0, 0, 0, 0},
+                                                  {1, 1, 1, 1}};
+        Matrix<bool> M(M_dense, false);
+
+        std::vector<std::vector<double>> ans_dense = {{0, 0, 0, 0},
+                                                      {11, 22, 32, 0},
+                                                      {0, 0, 0, 0}};
+        Matrix<double> answer(ans_dense, 0.);
+
+        Matrix<double> C(3, 4);
+        apply(C, complement(structure(M)), NoAccumulate(),
+              [](double val, IndexType ii, IndexType jj)
+              { return 10.0 * (ii + jj) + val; },
+              A);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+}
+
+//****************************************************************************
+// Vector write-back with complement and structural complement masks (the
+// mask has a stored false), with and without an accumulator.
+BOOST_AUTO_TEST_CASE(sparse_apply_vector_complement_masks)
+{
+    grb::Vector<double> u(6);
+    u.setElement(0, 1.);  u.setElement(1, 2.);
+    u.setElement(3, 4.);  u.setElement(5, 6.);
+
+    grb::Vector<double> w0(6);
+    w0.setElement(0, 10.); w0.setElement(2, 30.);
+    w0.setElement(3, 40.); w0.setElement(4, 50.);
+
+    grb::Vector<bool> m(6);
+    m.setElement(0, true);  m.setElement(1, false);
+    m.setElement(2, true);  m.setElement(3, false);
+
+    auto make = [](std::vector<std::tuple<grb::IndexType, double>> const &t)
+    {
+        grb::Vector<double> v(6);
+        for (auto&& [idx, val] : t) v.setElement(idx, val);
+        return v;
+    };
+
+    // complement: writes at 1, 3, 4 and 5
+    grb::Vector<double> w(w0);
+    grb::apply(w, grb::complement(m), grb::NoAccumulate(),
+               grb::AdditiveInverse<double>(), u);
+    BOOST_CHECK_EQUAL(w, make({{0, 10.}, {1, -2.}, {2, 30.}, {3, -4.},
+                               {5, -6.}}));
+
+    w = w0;
+    grb::apply(w, grb::complement(m), grb::NoAccumulate(),
+               grb::AdditiveInverse<double>(), u, grb::REPLACE);
+    BOOST_CHECK_EQUAL(w, make({{1, -2.}, {3, -4.}, {5, -6.}}));
+
+    w = w0;
+    grb::apply(w, grb::complement(m), grb::Plus<double>(),
+               grb::AdditiveInverse<double>(), u, grb::REPLACE);
+    BOOST_CHECK_EQUAL(w, make({{1, -2.}, {3, 36.}, {4, 50.}, {5, -6.}}));
+
+    // structural complement: writes only at 4 and 5
+    w = w0;
+    grb::apply(w, grb::complement(grb::structure(m)), grb::NoAccumulate(),
+               grb::AdditiveInverse<double>(), u);
+    BOOST_CHECK_EQUAL(w, make({{0, 10.}, {2, 30.}, {3, 40.}, {5, -6.}}));
+
+    w = w0;
+    grb::apply(w, grb::complement(grb::structure(m)), grb::Plus<double>(),
+               grb::AdditiveInverse<double>(), u);
+    BOOST_CHECK_EQUAL(w, make({{0, 10.}, {2, 30.}, {3, 40.}, {4, 50.},
+                               {5, -6.}}));
+
+    w = w0;
+    grb::apply(w, grb::complement(grb::structure(m)), grb::Plus<double>(),
+               grb::AdditiveInverse<double>(), u, grb::REPLACE);
+    BOOST_CHECK_EQUAL(w, make({{4, 50.}, {5, -6.}}));
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(sparse_apply_matrix_scmp_structure_masked_accum)
+{
+    std::vector<std::vector<double>> a_dense = {{2, 3, 0},
+                                                {0, 4, 5},
+                                                {6, 0, 0}};
+    std::vector<std::vector<double>> c_dense = {{10,  0, 20},
+                                                {30, 40,  0},
+                                                { 0,  0, 50}};
+    grb::Matrix<double> mA(a_dense, 0.);
+
+    // Stored zeros at (0,0) and (2,0) still block the structural complement
+    grb::Matrix<int> Mask(3, 3);
+    grb::IndexArrayType mask_rows = {0, 1, 2, 2};
+    grb::IndexArrayType mask_cols = {0, 1, 0, 2};
+    std::vector<int>    mask_vals = {0, 1, 0, 1};
+    Mask.build(mask_rows, mask_cols, mask_vals);
+
+    std::vector<std::vector<double>> merge_dense = {{ 10,  -3,  20},
+                                                    { 30,  40,  -5},
+                                                    {  0,   0,  50}};
+    grb::Matrix<double> Result(c_dense, 0.);
+    grb::apply(Result, grb::complement(grb::structure(Mask)),
+               grb::Plus<double>(), grb::AdditiveInverse<double>(),
+               mA, grb::MERGE);
+    BOOST_CHECK_EQUAL(Result, grb::Matrix<double>(merge_dense, 0.));
+
+    std::vector<std::vector<double>> replace_dense = {{  0,  -3,  20},
+                                                      { 30,   0,  -5},
+                                                      {  0,   0,   0}};
+    grb::Matrix<double> Result2(c_dense, 0.);
+    grb::apply(Result2, grb::complement(grb::structure(Mask)),
+               grb::Plus<double>(), grb::AdditiveInverse<double>(),
+               mA, grb::REPLACE);
+    BOOST_CHECK_EQUAL(Result2, grb::Matrix<double>(replace_dense, 0.));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * This Software includes and/or makes use of the following Third-Party Software
+ * subject to its own license:
+ *
+ * 1. Boost Unit Test Framework
+ * (https://www.boost.org/doc/libs/1_45_0/libs/test/doc/html/utf.html)
+ * Copyright 2001 Boost software license, Gennadiy Rozental.
+ *
+ * DM20-0442
+ */
+
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <graphblas/graphblas.hpp>
+
+using namespace grb;
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_MODULE context_test_suite
+
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+namespace
+{
+    std::vector<std::vector<double>> A_dense = {{1, 0, 2, 0},
+                                                {0, 3, 0, 4},
+                                                {5, 0, 6, 0},
+                                                {0, 7, 0, 8}};
+    std::vector<std::vector<double>> M_dense = {{1, 1, 0, 0},
+                                                {0, 0, 1, 1},
+                                                {1, 0, 0, 1},
+                                                {0, 0, 0, 0}};
+    // A*A
+    std::vector<std::vector<double>> AA_dense = {{11,  0, 14,  0},
+                                                 { 0, 37,  0, 44},
+                                                 {35,  0, 46,  0},
+                                                 { 0, 77,  0, 92}};
+    // A*A masked by M (replace)
+    std::vector<std::vector<double>> MAA_dense = {{11,  0,  0,  0},
+                                                  { 0,  0,  0, 44},
+                                                  {35,  0,  0,  0},
+                                                  { 0,  0,  0,  0}};
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_context_defaults)
+{
+    Context ctx;
+    BOOST_CHECK_EQUAL(ctx.num_threads, 0);
+    BOOST_CHECK_EQUAL(ctx.scratch_limit, 0U);
+    BOOST_CHECK_EQUAL(ctx.mxm_kernel, MXM_KERNEL_AUTO);
+    BOOST_CHECK(!ctx.perf_log);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_context_from_environment)
+{
+    setenv("GRB_NUM_THREADS", "2", 1);
+    setenv("GRB_SCRATCH_LIMIT", "4096", 1);
+    setenv("GRB_MXM_KERNEL", "dot", 1);
+    setenv("GRB_DENSE_THRESHOLD", "0.5", 1);
+
+    Context ctx(Context::from_environment());
+    BOOST_CHECK_EQUAL(ctx.num_threads, 2);
+    BOOST_CHECK_EQUAL(ctx.scratch_limit, 4096U);
+    BOOST_CHECK_EQUAL(ctx.mxm_kernel, MXM_KERNEL_DOT);
+    BOOST_CHECK_EQUAL(ctx.dense_threshold, 0.5);
+
+    setenv("GRB_MXM_KERNEL", "hash", 1);
+    BOOST_CHECK_THROW(Context::from_environment(), InvalidValueException);
+
+    unsetenv("GRB_NUM_THREADS");
+    unsetenv("GRB_SCRATCH_LIMIT");
+    unsetenv("GRB_MXM_KERNEL");
+    unsetenv("GRB_DENSE_THRESHOLD");
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_context_scoped)
+{
+    init(Context());
+    {
+        Context ctx;
+        ctx.mxm_kernel = MXM_KERNEL_PUSH;
+        ScopedContext scope(ctx);
+        BOOST_CHECK_EQUAL(context().mxm_kernel, MXM_KERNEL_PUSH);
+    }
+    BOOST_CHECK_EQUAL(context().mxm_kernel, MXM_KERNEL_AUTO);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_context_perf_log)
+{
+    std::vector<std::string> names;
+    Context ctx;
+    ctx.perf_log = [&names](std::string const &name, double seconds)
+        {
+            BOOST_CHECK(seconds >= 0.);
+            names.push_back(name);
+        };
+    ScopedContext scope(ctx);
+
+    Matrix<double> A(A_dense, 0.), C(4, 4);
+    mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+    double sum(0.);
+    reduce(sum, NoAccumulate(), PlusMonoid<double>(), C);
+
+    BOOST_REQUIRE_EQUAL(names.size(), 2U);
+    BOOST_CHECK_EQUAL(names[0].substr(0, 3), "mxm");
+    BOOST_CHECK_EQUAL(names[1].substr(0, 6), "reduce");
+}
+
+//****************************************************************************
+// The kernel hints and thresholds change how mxm is computed, not the result
+BOOST_AUTO_TEST_CASE(test_context_mxm_kernel_hints)
+{
+    Matrix<double> A(A_dense, 0.), M(M_dense, 0.);
+    Matrix<double> AA(AA_dense, 0.), MAA(MAA_dense, 0.);
+    Matrix<bool>   B(4, 4), BB(4, 4);
+    apply(B, NoMask(), NoAccumulate(), Identity<double, bool>(), A);
+    apply(BB, NoMask(), NoAccumulate(), Identity<double, bool>(), AA);
+
+    for (auto kernel : {MXM_KERNEL_AUTO, MXM_KERNEL_SPA,
+                        MXM_KERNEL_PUSH, MXM_KERNEL_DOT})
+    {
+        for (double threshold : {0., 1.})
+        {
+            Context ctx;
+            ctx.mxm_kernel = kernel;
+            ctx.dense_threshold = threshold;
+            ctx.scratch_limit = 1;  // release the scratch space every time
+            ScopedContext scope(ctx);
+
+            Matrix<double> C(4, 4);
+            mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+            BOOST_CHECK_EQUAL(C, AA);
+
+            Matrix<double> C2(4, 4);
+            mxm(C2, M, NoAccumulate(), ArithmeticSemiring<double>(), A, A,
+                REPLACE);
+            BOOST_CHECK_EQUAL(C2, MAA);
+
+            Matrix<double> C3(4, 4);
+            mxm(C3, structure(M), Plus<double>(), ArithmeticSemiring<double>(),
+                A, A, REPLACE);
+            BOOST_CHECK_EQUAL(C3, MAA);
+
+            Matrix<bool> C4(4, 4);
+            mxm(C4, NoMask(), NoAccumulate(), LogicalSemiring<bool>(), B, B);
+            BOOST_CHECK_EQUAL(C4, BB);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1261,4 +1261,116 @@ BOOST_AUTO_TEST_CASE(test_ewiseadd_matrix_scmp_masked_a_and_b_transpose)
 }
 
 
+//****************************************************************************
+// Accumulate and masked write-back are fused into one row-wise pass: check
+// accum + mask with replace and merge, including an empty mask row.
+BOOST_AUTO_TEST_CASE(test_ewiseadd_matrix_masked_accum_replace)
+{
+    std::vector<std::vector<double>> a_dense = {{1, 0, 2},
+                                                {0, 3, 0},
+                                                {4, 0, 0}};
+    std::vector<std::vector<double>> b_dense = {{1, 1, 0},
+                                                {0, 0, 0},
+                                                {0, 0, 5}};
+    std::vector<std::vector<double>> c_dense = {{10,  0,  0},
+                                                {20, 20,  0},
+                                                { 0,  0, 30}};
+    std::vector<std::vector<bool>>   m_dense = {{1, 1, 0},
+                                                {0, 0, 0},
+                                                {1, 0, 1}};
+    grb::Matrix<double> mA(a_dense, 0.), mB(b_dense, 0.);
+    grb::Matrix<bool>   Mask(m_dense, false);
+
+    std::vector<std::vector<double>> replace_dense = {{12, 1,  0},
+                                                      { 0, 0,  0},
+                                                      { 4, 0, 35}};
+    grb::Matrix<double> Result(c_dense, 0.);
+    grb::eWiseAdd(Result, Mask, grb::Plus<double>(),
+                  grb::Plus<double>(), mA, mB, grb::REPLACE);
+    BOOST_CHECK_EQUAL(Result, grb::Matrix<double>(replace_dense, 0.));
+
+    std::vector<std::vector<double>> merge_dense = {{12,  1,  0},
+                                                    {20, 20,  0},
+                                                    { 4,  0, 35}};
+    grb::Matrix<double> Result2(c_dense, 0.);
+    grb::eWiseAdd(Result2, Mask, grb::Plus<double>(),
+                  grb::Plus<double>(), mA, mB, grb::MERGE);
+    BOOST_CHECK_EQUAL(Result2, grb::Matrix<double>(merge_dense, 0.));
+}
+
+//****************************************************************************
+// The fused write-back reads C while it writes it: C is also an input here.
+BOOST_AUTO_TEST_CASE(test_ewiseadd_matrix_masked_accum_aliased)
+{
+    std::vector<std::vector<double>> b_dense = {{1, 1, 0},
+                                                {0, 0, 0},
+                                                {0, 0, 5}};
+    std::vector<std::vector<double>> c_dense = {{10,  0,  0},
+                                                {20, 20,  0},
+                                                { 0,  0, 30}};
+    std::vector<std::vector<bool>>   m_dense = {{1, 1, 0},
+                                                {0, 0, 0},
+                                                {1, 0, 1}};
+    grb::Matrix<double> mB(b_dense, 0.);
+    grb::Matrix<bool>   Mask(m_dense, false);
+
+    // C<M,replace> = C + (C + B)
+    std::vector<std::vector<double>> replace_dense = {{21, 1,  0},
+                                                      { 0, 0,  0},
+                                                      { 0, 0, 65}};
+    grb::Matrix<double> C(c_dense, 0.);
+    grb::eWiseAdd(C, Mask, grb::Plus<double>(),
+                  grb::Plus<double>(), C, mB, grb::REPLACE);
+    BOOST_CHECK_EQUAL(C, grb::Matrix<double>(replace_dense, 0.));
+
+    // C<!M,merge> = C + (C + B)
+    std::vector<std::vector<double>> merge_dense = {{10,  0,  0},
+                                                    {40, 40,  0},
+                                                    { 0,  0, 30}};
+    grb::Matrix<double> C2(c_dense, 0.);
+    grb::eWiseAdd(C2, grb::complement(Mask), grb::Plus<double>(),
+                  grb::Plus<double>(), C2, mB, grb::MERGE);
+    BOOST_CHECK_EQUAL(C2, grb::Matrix<double>(merge_dense, 0.));
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_ewiseadd_matrix_scmp_structure_masked_accum)
+{
+    std::vector<std::vector<double>> a_dense = {{2, 3, 0},
+                                                {0, 4, 5},
+                                                {6, 0, 0}};
+    std::vector<std::vector<double>> b_dense = {{1, 1, 1},
+                                                {0, 2, 2},
+                                                {3, 0, 1}};
+    std::vector<std::vector<double>> c_dense = {{10,  0, 20},
+                                                {30, 40,  0},
+                                                { 0,  0, 50}};
+    grb::Matrix<double> mA(a_dense, 0.), mB(b_dense, 0.);
+
+    // Stored zeros at (0,0) and (2,0) still block the structural complement
+    grb::Matrix<int> Mask(3, 3);
+    grb::IndexArrayType mask_rows = {0, 1, 2, 2};
+    grb::IndexArrayType mask_cols = {0, 1, 0, 2};
+    std::vector<int>    mask_vals = {0, 1, 0, 1};
+    Mask.build(mask_rows, mask_cols, mask_vals);
+
+    std::vector<std::vector<double>> merge_dense = {{ 10,   4,  21},
+                                                    { 30,  40,   7},
+                                                    {  0,   0,  50}};
+    grb::Matrix<double> Result(c_dense, 0.);
+    grb::eWiseAdd(Result, grb::complement(grb::structure(Mask)),
+                  grb::Plus<double>(), grb::Plus<double>(),
+                  mA, mB, grb::MERGE);
+    BOOST_CHECK_EQUAL(Result, grb::Matrix<double>(merge_dense, 0.));
+
+    std::vector<std::vector<double>> replace_dense = {{  0,   4,  21},
+                                                      { 30,   0,   7},
+                                                      {  0,   0,   0}};
+    grb::Matrix<double> Result2(c_dense, 0.);
+    grb::eWiseAdd(Result2, grb::complement(grb::structure(Mask)),
+                  grb::Plus<double>(), grb::Plus<double>(),
+                  mA, mB, grb::REPLACE);
+    BOOST_CHECK_EQUAL(Result2, grb::Matrix<double>(replace_dense, 0.));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
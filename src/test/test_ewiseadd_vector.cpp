@@ -889,4 +889,33 @@ BOOST_AUTO_TEST_CASE(test_ewiseadd_vector_accum)
     BOOST_CHECK_EQUAL(result2, ans2);
 }
 
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_ewiseadd_vector_scmp_structure_masked_accum)
+{
+    std::vector<double> u_dense = { 2, 3,  0,  4,  0};
+    std::vector<double> v_dense = { 1, 0,  2,  5,  0};
+    std::vector<double> w_dense = {10, 0, 20, 30, 40};
+    grb::Vector<double> u(u_dense, 0.), v(v_dense, 0.);
+
+    // A stored zero at 1 still blocks the structural complement
+    grb::Vector<int> mask(5);
+    grb::IndexArrayType mask_idx = {1, 3};
+    std::vector<int>    mask_vals = {0, 1};
+    mask.build(mask_idx, mask_vals);
+
+    std::vector<double> merge_dense = {13, 0, 22, 30, 40};
+    grb::Vector<double> result(w_dense, 0.);
+    grb::eWiseAdd(result, grb::complement(grb::structure(mask)),
+                  grb::Plus<double>(), grb::Plus<double>(),
+                  u, v, grb::MERGE);
+    BOOST_CHECK_EQUAL(result, grb::Vector<double>(merge_dense, 0.));
+
+    std::vector<double> replace_dense = {13, 0, 22, 0, 40};
+    grb::Vector<double> result2(w_dense, 0.);
+    grb::eWiseAdd(result2, grb::complement(grb::structure(mask)),
+                  grb::Plus<double>(), grb::Plus<double>(),
+                  u, v, grb::REPLACE);
+    BOOST_CHECK_EQUAL(result2, grb::Vector<double>(replace_dense, 0.));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1270,4 +1270,44 @@ BOOST_AUTO_TEST_CASE(test_ewisemult_matrix_scmp_masked_a_and_b_transpose)
 }
 
 
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_ewisemult_matrix_scmp_structure_masked_accum)
+{
+    std::vector<std::vector<double>> a_dense = {{2, 3, 0},
+                                                {0, 4, 5},
+                                                {6, 0, 0}};
+    std::vector<std::vector<double>> b_dense = {{1, 1, 1},
+                                                {0, 2, 2},
+                                                {3, 0, 1}};
+    std::vector<std::vector<double>> c_dense = {{10,  0, 20},
+                                                {30, 40,  0},
+                                                { 0,  0, 50}};
+    grb::Matrix<double> mA(a_dense, 0.), mB(b_dense, 0.);
+
+    // Stored zeros at (0,0) and (2,0) still block the structural complement
+    grb::Matrix<int> Mask(3, 3);
+    grb::IndexArrayType mask_rows = {0, 1, 2, 2};
+    grb::IndexArrayType mask_cols = {0, 1, 0, 2};
+    std::vector<int>    mask_vals = {0, 1, 0, 1};
+    Mask.build(mask_rows, mask_cols, mask_vals);
+
+    std::vector<std::vector<double>> merge_dense = {{ 10,   3,  20},
+                                                    { 30,  40,  10},
+                                                    {  0,   0,  50}};
+    grb::Matrix<double> Result(c_dense, 0.);
+    grb::eWiseMult(Result, grb::complement(grb::structure(Mask)),
+                   grb::Plus<double>(), grb::Times<double>(),
+                   mA, mB, grb::MERGE);
+    BOOST_CHECK_EQUAL(Result, grb::Matrix<double>(merge_dense, 0.));
+
+    std::vector<std::vector<double>> replace_dense = {{  0,   3,  20},
+                                                      { 30,   0,  10},
+                                                      {  0,   0,   0}};
+    grb::Matrix<double> Result2(c_dense, 0.);
+    grb::eWiseMult(Result2, grb::complement(grb::structure(Mask)),
+                   grb::Plus<double>(), grb::Times<double>(),
+                   mA, mB, grb::REPLACE);
+    BOOST_CHECK_EQUAL(Result2, grb::Matrix<double>(replace_dense, 0.));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
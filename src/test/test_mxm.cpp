@@ -2263,4 +2263,59 @@ BOOST_AUTO_TEST_CASE(test_mxm_CompMask_Accum_ATBT_Merge)
     BOOST_CHECK_EQUAL(result, answer);
 }
 
+//****************************************************************************
+// The boolean OR-AND and floating point PLUS-TIMES semirings use specialized
+// row kernels; compare them with the same algebra through the generic path.
+namespace
+{
+    GEN_GRAPHBLAS_SEMIRING(GenericOrAndSemiring, LogicalOrMonoid, LogicalAnd)
+    GEN_GRAPHBLAS_SEMIRING(GenericPlusTimesSemiring, PlusMonoid, Times)
+}
+
+BOOST_AUTO_TEST_CASE(test_mxm_logical_bool_kernel)
+{
+    grb::IndexType const N(130);
+    grb::IndexArrayType i = {0,   0,  1,  1,   2, 129, 129, 64, 63,  63};
+    grb::IndexArrayType j = {0, 127, 63, 64, 128,   1, 129, 65, 64, 129};
+    std::vector<bool>   v = {true, true, false, true, true,
+                             true, true, true, false, true};
+
+    grb::Matrix<bool> A(N, N);
+    A.build(i.begin(), j.begin(), v.begin(), i.size());
+
+    grb::Matrix<bool> result(N, N), answer(N, N);
+    grb::mxm(result, grb::NoMask(), grb::NoAccumulate(),
+             grb::LogicalSemiring<bool>(), A, A);
+    grb::mxm(answer, grb::NoMask(), grb::NoAccumulate(),
+             GenericOrAndSemiring<bool>(), A, A);
+    BOOST_CHECK_EQUAL(result, answer);
+
+    grb::mxm(result, grb::NoMask(), grb::LogicalOr<bool>(),
+             grb::LogicalSemiring<bool>(), A, A);
+    grb::mxm(answer, grb::NoMask(), grb::LogicalOr<bool>(),
+             GenericOrAndSemiring<bool>(), A, A);
+    BOOST_CHECK_EQUAL(result, answer);
+}
+
+BOOST_AUTO_TEST_CASE(test_mxm_plus_times_kernel)
+{
+    grb::IndexType const N(70);
+    grb::IndexArrayType i = {0,  0,  1,  1,  2, 69, 69,  3};
+    grb::IndexArrayType j = {0, 68,  3, 69,  1,  0,  2,  3};
+    std::vector<double> v = {-1., 2., 0.5, -3., 4., 0., 1.5, 2.};
+
+    grb::Matrix<double> A(N, N);
+    A.build(i.begin(), j.begin(), v.begin(), i.size());
+
+    grb::Matrix<double> result(N, N), answer(N, N);
+    grb::mxm(result, grb::NoMask(), grb::NoAccumulate(),
+             grb::ArithmeticSemiring<double>(), A, A);
+    grb::mxm(answer, grb::NoMask(), grb::NoAccumulate(),
+             GenericPlusTimesSemiring<double>(), A, A);
+    BOOST_CHECK_EQUAL(result, answer);
+
+    // A(69,0)*A(0,0) = 0*(-1) = -0.0 is the only product in C(69,0)
+    BOOST_CHECK(std::signbit(result.extractElement(69, 0)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -5007,4 +5007,93 @@ BOOST_AUTO_TEST_CASE(test_mxm_CompStructMask_Accum_AB_Merge_ABdup)
 }
 
 
+//****************************************************************************
+// A hub row plus a ring: row 0 generates most of the work, so the multithreaded
+// kernels split it across threads and add the partial rows back together.
+BOOST_AUTO_TEST_CASE(test_mxm_AB_hub_row)
+{
+    IndexType const n = 200;
+    IndexArrayType rows, cols;
+    std::vector<double> vals;
+    for (IndexType j = 0; j < n; ++j)
+    {
+        rows.push_back(0); cols.push_back(j); vals.push_back(j % 7 + 1);
+    }
+    for (IndexType i = 1; i < n; ++i)
+    {
+        rows.push_back(i); cols.push_back(i % (n - 1) + 1);
+        vals.push_back(2);
+        rows.push_back(i); cols.push_back((i + 1) % (n - 1) + 1);
+        vals.push_back(i % 5 + 1);
+    }
+    Matrix<double> A(n, n);
+    A.build(rows, cols, vals);
+
+    // Dense reference products (exact: small integers)
+    std::vector<std::vector<double>> a(n, std::vector<double>(n, 0.));
+    std::vector<std::vector<bool>>   a_set(n, std::vector<bool>(n, false));
+    for (IndexType idx = 0; idx < vals.size(); ++idx)
+    {
+        a[rows[idx]][cols[idx]] = vals[idx];
+        a_set[rows[idx]][cols[idx]] = true;
+    }
+
+    IndexArrayType ans_rows, ans_cols;
+    std::vector<double> sum_vals, min_vals;
+    for (IndexType i = 0; i < n; ++i)
+    {
+        for (IndexType j = 0; j < n; ++j)
+        {
+            bool set(false);
+            double sum(0.), min(0.);
+            for (IndexType k = 0; k < n; ++k)
+            {
+                if (!a_set[i][k] || !a_set[k][j]) continue;
+                sum += a[i][k]*a[k][j];
+                min = set ? std::min(min, a[i][k] + a[k][j])
+                          : a[i][k] + a[k][j];
+                set = true;
+            }
+            if (set)
+            {
+                ans_rows.push_back(i); ans_cols.push_back(j);
+                sum_vals.push_back(sum); min_vals.push_back(min);
+            }
+        }
+    }
+    Matrix<double> answer(n, n), min_answer(n, n);
+    answer.build(ans_rows, ans_cols, sum_vals);
+    min_answer.build(ans_rows, ans_cols, min_vals);
+
+    Matrix<double> C(n, n);
+    mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+    BOOST_CHECK_EQUAL(C, answer);
+
+    // C += A*A
+    std::vector<double> twice_vals(sum_vals);
+    for (auto &val : twice_vals) val *= 2.;
+    Matrix<double> twice_answer(n, n);
+    twice_answer.build(ans_rows, ans_cols, twice_vals);
+    mxm(C, NoMask(), Plus<double>(), ArithmeticSemiring<double>(), A, A);
+    BOOST_CHECK_EQUAL(C, twice_answer);
+
+    // Masked kernels use the same (unsplit) schedule
+    Matrix<double> C2(n, n);
+    mxm(C2, answer, NoAccumulate(), ArithmeticSemiring<double>(), A, A,
+        REPLACE);
+    BOOST_CHECK_EQUAL(C2, answer);
+
+    Matrix<double> C3(n, n);
+    mxm(C3, NoMask(), NoAccumulate(), MinPlusSemiring<double>(), A, A);
+    BOOST_CHECK_EQUAL(C3, min_answer);
+
+    Matrix<bool> B(n, n), B_answer(n, n), C4(n, n);
+    std::vector<bool> trues(vals.size(), true), ans_trues(ans_rows.size(), true);
+    B.build(rows.begin(), cols.begin(), trues.begin(), trues.size());
+    B_answer.build(ans_rows.begin(), ans_cols.begin(), ans_trues.begin(),
+                   ans_trues.size());
+    mxm(C4, NoMask(), NoAccumulate(), LogicalSemiring<bool>(), B, B);
+    BOOST_CHECK_EQUAL(C4, B_answer);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
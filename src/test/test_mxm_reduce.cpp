@@ -0,0 +1,152 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * This Software includes and/or makes use of the following Third-Party Software
+ * subject to its own license:
+ *
+ * 1. Boost Unit Test Framework
+ * (https://www.boost.org/doc/libs/1_45_0/libs/test/doc/html/utf.html)
+ * Copyright 2001 Boost software license, Gennadiy Rozental.
+ *
+ * DM20-0442
+ */
+
+
+#include <graphblas/graphblas.hpp>
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_MODULE mxm_reduce_test_suite
+
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+//****************************************************************************
+namespace
+{
+    std::vector<std::vector<double> > mA_dense = {{8, 1, 6, 0},
+                                                  {3, 0, 7, 2},
+                                                  {0, 9, 2, 0},
+                                                  {4, 0, 0, 5}};
+
+    std::vector<std::vector<double> > mB_dense = {{0, 2, 0, 1},
+                                                  {5, 0, 3, 0},
+                                                  {0, 4, 0, 6},
+                                                  {7, 0, 1, 0}};
+
+    std::vector<std::vector<double> > mM_dense = {{1, 1, 0, 0},
+                                                  {0, 1, 0, 1},
+                                                  {1, 0, 0, 0},
+                                                  {0, 0, 1, 1}};
+
+    // reference: mxm into a temporary and reduce it
+    template <typename MaskT, typename AMatrixT, typename BMatrixT>
+    double reference(MaskT const &M, AMatrixT const &A, BMatrixT const &B)
+    {
+        grb::Matrix<double> C(4, 4);
+        grb::mxm(C, M, grb::NoAccumulate(),
+                 grb::ArithmeticSemiring<double>(), A, B, grb::REPLACE);
+        double sum = 0.;
+        grb::reduce(sum, grb::NoAccumulate(), grb::PlusMonoid<double>(), C);
+        return sum;
+    }
+
+    template <typename MaskT, typename AMatrixT, typename BMatrixT>
+    void check_all(MaskT const &M, AMatrixT const &A, BMatrixT const &B)
+    {
+        double val = -1.;
+        grb::mxm_reduce(val, M, grb::PlusMonoid<double>(),
+                        grb::ArithmeticSemiring<double>(), A, B);
+        BOOST_CHECK_EQUAL(val, reference(M, A, B));
+    }
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_mxm_reduce_bad_dimensions)
+{
+    grb::Matrix<double> mA(mA_dense, 0.);
+    grb::Matrix<double> mC(3, 4);
+    grb::Matrix<bool>   mM(3, 3);
+    double val = 0.;
+
+    BOOST_CHECK_THROW(
+        (grb::mxm_reduce(val, grb::NoMask(), grb::PlusMonoid<double>(),
+                         grb::ArithmeticSemiring<double>(), mA, mC)),
+        grb::DimensionException);
+
+    BOOST_CHECK_THROW(
+        (grb::mxm_reduce(val, mM, grb::PlusMonoid<double>(),
+                         grb::ArithmeticSemiring<double>(), mA, mA)),
+        grb::DimensionException);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_mxm_reduce_masks)
+{
+    grb::Matrix<double> A(mA_dense, 0.);
+    grb::Matrix<double> B(mB_dense, 0.);
+    grb::Matrix<double> M(mM_dense, 0.);
+    M.setElement(2, 2, 0.);   // stored zero in the mask
+
+    check_all(grb::NoMask(), A, B);
+    check_all(M, A, B);
+    check_all(grb::structure(M), A, B);
+    check_all(grb::complement(M), A, B);
+    check_all(grb::complement(grb::structure(M)), A, B);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_mxm_reduce_transposes)
+{
+    grb::Matrix<double> A(mA_dense, 0.);
+    grb::Matrix<double> B(mB_dense, 0.);
+    grb::Matrix<double> M(mM_dense, 0.);
+
+    check_all(M, grb::transpose(A), B);
+    check_all(M, A, grb::transpose(B));
+    check_all(M, grb::transpose(A), grb::transpose(B));
+    check_all(grb::structure(M), A, grb::transpose(B));
+    check_all(grb::complement(M), A, grb::transpose(B));
+    check_all(grb::NoMask(), grb::transpose(A), grb::transpose(B));
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_mxm_reduce_terminal)
+{
+    grb::Matrix<bool> A(4, 4), B(4, 4);
+    A.setElement(0, 1, true);
+    A.setElement(3, 2, true);
+    B.setElement(1, 3, true);
+
+    bool found = false;
+    grb::mxm_reduce(found, grb::NoMask(), grb::LogicalOrMonoid<bool>(),
+                    grb::LogicalSemiring<bool>(), A, B);
+    BOOST_CHECK_EQUAL(found, true);
+
+    grb::mxm_reduce(found, grb::NoMask(), grb::LogicalOrMonoid<bool>(),
+                    grb::LogicalSemiring<bool>(), A, A);
+    BOOST_CHECK_EQUAL(found, false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -778,5 +778,112 @@ BOOST_AUTO_TEST_CASE(mxv_reg)
     BOOST_CHECK_EQUAL(result, ans4);
 }
 
+//****************************************************************************
+// The boolean OR-AND semiring uses a specialized (packed) kernel; check that
+// stored false values and word boundaries are handled like the generic one.
+BOOST_AUTO_TEST_CASE(test_mxv_logical_bool)
+{
+    grb::IndexType const N(130);
+    grb::IndexArrayType i = {0,   0,  1,  1,   2, 129, 129, 64};
+    grb::IndexArrayType j = {0, 127, 63, 64, 128,   1, 129, 65};
+    std::vector<bool>   v = {true, true, false, true, true, true, true, true};
+
+    // A(row, col) and AT = A'
+    grb::Matrix<bool> A(N, N), AT(N, N);
+    A.build(i.begin(), j.begin(), v.begin(), i.size());
+    AT.build(j.begin(), i.begin(), v.begin(), i.size());
+
+    grb::Vector<bool> u(N);
+    u.setElement(0,   false);
+    u.setElement(63,  true);
+    u.setElement(64,  false);
+    u.setElement(127, true);
+    u.setElement(129, true);
+
+    // row 0: (F and F) or (T and T) = T; row 1: (F and T) or (T and F) = F
+    // row 2: no intersection; row 64: no intersection; row 129: T
+    grb::Vector<bool> ans(N);
+    ans.setElement(0,   true);
+    ans.setElement(1,   false);
+    ans.setElement(129, true);
+
+    grb::Vector<bool> w(N);
+    grb::mxv(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::LogicalSemiring<bool>(), A, u);
+    BOOST_CHECK_EQUAL(w, ans);
+
+    w.clear();
+    grb::mxv(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::LogicalSemiring<bool>(), grb::transpose(AT), u);
+    BOOST_CHECK_EQUAL(w, ans);
+}
+
+
+//****************************************************************************
+// ANY-PAIR only depends on structure: stored zeros still produce a one.
+BOOST_AUTO_TEST_CASE(test_mxv_any_pair)
+{
+    grb::IndexType const N(70);
+    grb::IndexArrayType i = {0,  0, 1,  2, 69};
+    grb::IndexArrayType j = {3, 68, 5, 69,  0};
+    std::vector<double> v = {0., 2., 4., 5.,  0.};
+
+    grb::Matrix<double> A(N, N), AT(N, N);
+    A.build(i.begin(), j.begin(), v.begin(), i.size());
+    AT.build(j.begin(), i.begin(), v.begin(), i.size());
+
+    grb::Vector<double> u(N);
+    u.setElement(3,  0.);
+    u.setElement(68, 7.);
+    u.setElement(0,  0.);
+
+    grb::Vector<int> ans(N);
+    ans.setElement(0,  1);
+    ans.setElement(69, 1);
+
+    grb::Vector<int> w(N);
+    grb::mxv(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::AnyPairSemiring<int>(), A, u);
+    BOOST_CHECK_EQUAL(w, ans);
+
+    w.clear();
+    grb::mxv(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::AnyPairSemiring<int>(), grb::transpose(AT), u);
+    BOOST_CHECK_EQUAL(w, ans);
+}
+
+//****************************************************************************
+// PLUS-TIMES on floating point sums only the stored products: a result that
+// is a single -0.0 product must stay -0.0.
+BOOST_AUTO_TEST_CASE(test_mxv_plus_times_negative_zero)
+{
+    grb::IndexType const N(70);
+    grb::IndexArrayType i = {0,  0, 1,  1};
+    grb::IndexArrayType j = {3, 68, 5, 68};
+    std::vector<double> v = {-1., 2., 4., -2.};
+
+    grb::Matrix<double> A(N, N), AT(N, N);
+    A.build(i.begin(), j.begin(), v.begin(), i.size());
+    AT.build(j.begin(), i.begin(), v.begin(), i.size());
+
+    // u(68) is not stored, so row 0 is -1*0 = -0.0 and row 1 is 4*-0.0
+    grb::Vector<double> u(N);
+    u.setElement(3, 0.);
+    u.setElement(5, -0.);
+
+    grb::Vector<double> w(N);
+    grb::mxv(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::ArithmeticSemiring<double>(), A, u);
+    BOOST_CHECK_EQUAL(w.nvals(), 2);
+    BOOST_CHECK(std::signbit(w.extractElement(0)));
+    BOOST_CHECK(std::signbit(w.extractElement(1)));
+
+    w.clear();
+    grb::mxv(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::ArithmeticSemiring<double>(), grb::transpose(AT), u);
+    BOOST_CHECK_EQUAL(w.nvals(), 2);
+    BOOST_CHECK(std::signbit(w.extractElement(0)));
+    BOOST_CHECK(std::signbit(w.extractElement(1)));
+}
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,321 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * This Software includes and/or makes use of the following Third-Party Software
+ * subject to its own license:
+ *
+ * 1. Boost Unit Test Framework
+ * (https://www.boost.org/doc/libs/1_45_0/libs/test/doc/html/utf.html)
+ * Copyright 2001 Boost software license, Gennadiy Rozental.
+ *
+ * DM20-0442
+ */
+
+
+
+#include <cmath>
+#include <vector>
+#include <graphblas/graphblas.hpp>
+#include <algorithms/page_rank.hpp>
+
+using namespace grb;
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_MODULE nonblocking_test_suite
+
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+namespace
+{
+    std::vector<std::vector<double>> A_dense = {{1, 0, 2, 0},
+                                                {0, 3, 0, 4},
+                                                {5, 0, 6, 0},
+                                                {0, 7, 0, 8}};
+    // A*A
+    std::vector<std::vector<double>> AA_dense = {{11,  0, 14,  0},
+                                                 { 0, 37,  0, 44},
+                                                 {35,  0, 46,  0},
+                                                 { 0, 77,  0, 92}};
+    // A*A + A
+    std::vector<std::vector<double>> AAA_dense = {{12,  0, 16,  0},
+                                                  { 0, 40,  0, 48},
+                                                  {40,  0, 52,  0},
+                                                  { 0, 84,  0,100}};
+
+    Context nonblocking_context()
+    {
+        Context ctx;
+        ctx.mode = NONBLOCKING;
+        return ctx;
+    }
+
+    std::size_t num_pending() { return detail::deferred_queue().size(); }
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_mode_from_environment)
+{
+    BOOST_CHECK_EQUAL(Context().mode, BLOCKING);
+
+    setenv("GRB_MODE", "nonblocking", 1);
+    BOOST_CHECK_EQUAL(Context::from_environment().mode, NONBLOCKING);
+    setenv("GRB_MODE", "blocking", 1);
+    BOOST_CHECK_EQUAL(Context::from_environment().mode, BLOCKING);
+    setenv("GRB_MODE", "lazy", 1);
+    BOOST_CHECK_THROW(Context::from_environment(), InvalidValueException);
+    unsetenv("GRB_MODE");
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_deferred_until_read)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    ScopedContext scope(nonblocking_context());
+
+    mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+    BOOST_CHECK_EQUAL(num_pending(), 1U);
+    BOOST_CHECK_EQUAL(C.nvals(), 8U);
+    BOOST_CHECK_EQUAL(num_pending(), 0U);
+    BOOST_CHECK_EQUAL(C, Matrix<double>(AA_dense, 0.));
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_wait)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    Matrix<double> D(4, 4);
+    ScopedContext scope(nonblocking_context());
+
+    mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+    eWiseAdd(D, NoMask(), NoAccumulate(), Plus<double>(), C, A);
+    BOOST_CHECK_EQUAL(num_pending(), 2U);
+
+    // Only the work C depends on runs
+    wait(C);
+    BOOST_CHECK_EQUAL(num_pending(), 1U);
+
+    wait();
+    BOOST_CHECK_EQUAL(num_pending(), 0U);
+    BOOST_CHECK_EQUAL(D, Matrix<double>(AAA_dense, 0.));
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_completed_by_blocking_mode)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    {
+        ScopedContext scope(nonblocking_context());
+        mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+        BOOST_CHECK_EQUAL(num_pending(), 1U);
+    }
+    BOOST_CHECK_EQUAL(num_pending(), 0U);
+    BOOST_CHECK_EQUAL(C, Matrix<double>(AA_dense, 0.));
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_write_after_read)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    Matrix<double> D(4, 4);
+    ScopedContext scope(nonblocking_context());
+
+    // D reads A before A is overwritten
+    mxm(D, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+    apply(A, NoMask(), NoAccumulate(), AdditiveInverse<double>(), A);
+    A.setElement(0, 1, 9.);
+
+    BOOST_CHECK_EQUAL(D, Matrix<double>(AA_dense, 0.));
+    BOOST_CHECK_EQUAL(A.extractElement(0, 0), -1.);
+    BOOST_CHECK_EQUAL(A.extractElement(0, 1), 9.);
+    BOOST_CHECK_EQUAL(A.nvals(), 9U);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_dead_write_dropped)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    ScopedContext scope(nonblocking_context());
+
+    mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+    // Overwrites all of C without reading it: the mxm is never run
+    eWiseAdd(C, NoMask(), NoAccumulate(), Plus<double>(), A, A);
+    BOOST_CHECK_EQUAL(num_pending(), 1U);
+
+    Matrix<double> A2(A_dense, 0.);
+    apply(A2, NoMask(), NoAccumulate(),
+          std::bind(Times<double>(), std::placeholders::_1, 2.), A);
+    BOOST_CHECK_EQUAL(C, A2);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_accumulated_write_kept)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    ScopedContext scope(nonblocking_context());
+
+    mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+    // Reads C through the accumulator
+    eWiseAdd(C, NoMask(), Plus<double>(), Plus<double>(), A, A);
+    // Reads C as an input
+    eWiseAdd(C, NoMask(), NoAccumulate(), Plus<double>(), C, A);
+    BOOST_CHECK_EQUAL(num_pending(), 3U);
+
+    Matrix<double> answer(4, 4);
+    {
+        ScopedContext blocking((Context()));
+        mxm(answer, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+        eWiseAdd(answer, NoMask(), Plus<double>(), Plus<double>(), A, A);
+        eWiseAdd(answer, NoMask(), NoAccumulate(), Plus<double>(), answer, A);
+    }
+    BOOST_CHECK_EQUAL(C, answer);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_temporary_released)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    ScopedContext scope(nonblocking_context());
+
+    {
+        Matrix<double> T(4, 4);
+        mxm(T, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+        eWiseAdd(C, NoMask(), NoAccumulate(), Plus<double>(), T, A);
+        // Never read: dropped when T goes away
+        apply(T, NoMask(), NoAccumulate(), AdditiveInverse<double>(), A);
+        BOOST_CHECK_EQUAL(num_pending(), 3U);
+    }
+    BOOST_CHECK_EQUAL(num_pending(), 0U);
+    BOOST_CHECK_EQUAL(C, Matrix<double>(AAA_dense, 0.));
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_apply_chain_fused)
+{
+    std::vector<double> u_dense = {1.5, 0, -2.25, 4};
+    Vector<double> u(u_dense, 0.);
+
+    auto half    = std::bind(Div<double>(), std::placeholders::_1, 2.);
+    auto plus_3  = std::bind(Plus<double>(), std::placeholders::_1, 3.);
+
+    // Each stage converts to int, as separate applies would
+    Vector<int> answer(4);
+    {
+        apply(answer, NoMask(), NoAccumulate(), AdditiveInverse<double>(), u);
+        apply(answer, NoMask(), NoAccumulate(), half, answer);
+        apply(answer, NoMask(), NoAccumulate(), plus_3, answer);
+    }
+
+    Vector<int> w(4);
+    ScopedContext scope(nonblocking_context());
+    apply(w, NoMask(), NoAccumulate(), AdditiveInverse<double>(), u);
+    apply(w, NoMask(), NoAccumulate(), half, w);
+    apply(w, NoMask(), NoAccumulate(), plus_3, w);
+    BOOST_CHECK_EQUAL(num_pending(), 1U);
+
+    BOOST_CHECK_EQUAL(w, answer);
+    BOOST_CHECK_EQUAL(w.extractElement(0), 3);   // -1.5 -> -1 -> 0 -> 3
+    BOOST_CHECK_EQUAL(w.extractElement(2), 4);   //  2.25 -> 2 -> 1 -> 4
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_matrix_apply_chain_fused)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    ScopedContext scope(nonblocking_context());
+
+    apply(C, NoMask(), NoAccumulate(), AdditiveInverse<double>(), A);
+    apply(C, NoMask(), NoAccumulate(), AdditiveInverse<double>(), C);
+    BOOST_CHECK_EQUAL(num_pending(), 1U);
+
+    // A transposed input, and a masked apply, are not chained
+    apply(C, NoMask(), NoAccumulate(), Identity<double>(), transpose(A));
+    apply(C, C, NoAccumulate(), AdditiveInverse<double>(), C);
+    BOOST_CHECK_EQUAL(num_pending(), 2U);
+
+    Matrix<double> answer(4, 4);
+    {
+        ScopedContext blocking((Context()));
+        apply(answer, NoMask(), NoAccumulate(), Identity<double>(), transpose(A));
+        apply(answer, answer, NoAccumulate(), AdditiveInverse<double>(), answer);
+    }
+    BOOST_CHECK_EQUAL(C, answer);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_reduce_to_scalar)
+{
+    Matrix<double> A(A_dense, 0.);
+    Matrix<double> C(4, 4);
+    ScopedContext scope(nonblocking_context());
+
+    mxm(C, NoMask(), NoAccumulate(), ArithmeticSemiring<double>(), A, A);
+    double sum = 0.;
+    reduce(sum, NoAccumulate(), PlusMonoid<double>(), C);
+    BOOST_CHECK_EQUAL(sum, 356.);
+    BOOST_CHECK_EQUAL(num_pending(), 0U);
+
+    Vector<double> r(4);
+    reduce(r, NoMask(), NoAccumulate(), Plus<double>(), A);
+    double total = 0.;
+    reduce(total, NoAccumulate(), PlusMonoid<double>(), r);
+    BOOST_CHECK_EQUAL(total, 36.);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(test_nonblocking_page_rank)
+{
+    std::vector<IndexType> i = {0, 0, 1, 2, 2, 3, 3, 4, 4, 4};
+    std::vector<IndexType> j = {1, 2, 2, 0, 3, 1, 4, 0, 2, 3};
+    std::vector<double>    v(i.size(), 1.);
+    Matrix<double> G(5, 5);
+    G.build(i, j, v);
+
+    Vector<double> blocking_rank(5);
+    algorithms::page_rank(G, blocking_rank);
+
+    Vector<double> nonblocking_rank(5);
+    {
+        ScopedContext scope(nonblocking_context());
+        algorithms::page_rank(G, nonblocking_rank);
+    }
+
+    BOOST_CHECK_EQUAL(nonblocking_rank.nvals(), 5U);
+    for (IndexType idx = 0; idx < 5; ++idx)
+    {
+        BOOST_CHECK_CLOSE(nonblocking_rank.extractElement(idx),
+                          blocking_rank.extractElement(idx), 1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
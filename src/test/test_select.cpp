@@ -0,0 +1,306 @@
+/*
+ * GraphBLAS Template Library (GBTL), Version 3.0
+ *
+ * Copyright 2020 Carnegie Mellon University, Battelle Memorial Institute, and
+ * Authors.
+ *
+ * THIS MATERIAL WAS PREPARED AS AN ACCOUNT OF WORK SPONSORED BY AN AGENCY OF
+ * THE UNITED STATES GOVERNMENT.  NEITHER THE UNITED STATES GOVERNMENT NOR THE
+ * UNITED STATES DEPARTMENT OF ENERGY, NOR THE UNITED STATES DEPARTMENT OF
+ * DEFENSE, NOR CARNEGIE MELLON UNIVERSITY, NOR BATTELLE, NOR ANY OF THEIR
+ * EMPLOYEES, NOR ANY JURISDICTION OR ORGANIZATION THAT HAS COOPERATED IN THE
+ * DEVELOPMENT OF THESE MATERIALS, MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR
+ * ASSUMES ANY LEGAL LIABILITY OR RESPONSIBILITY FOR THE ACCURACY, COMPLETENESS,
+ * OR USEFULNESS OR ANY INFORMATION, APPARATUS, PRODUCT, SOFTWARE, OR PROCESS
+ * DISCLOSED, OR REPRESENTS THAT ITS USE WOULD NOT INFRINGE PRIVATELY OWNED
+ * RIGHTS.
+ *
+ * Released under a BSD-style license, please see LICENSE file or contact
+ * permission@sei.cmu.edu for full terms.
+ *
+ * [DISTRIBUTION STATEMENT A] This material has been approved for public release
+ * and unlimited distribution.  Please see Copyright notice for non-US
+ * Government use and distribution.
+ *
+ * This Software includes and/or makes use of the following Third-Party Software
+ * subject to its own license:
+ *
+ * 1. Boost Unit Test Framework
+ * (https://www.boost.org/doc/libs/1_45_0/libs/test/doc/html/utf.html)
+ * Copyright 2001 Boost software license, Gennadiy Rozental.
+ *
+ * DM20-0442
+ */
+
+
+#define GRAPHBLAS_LOGGING_LEVEL 0
+
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include <graphblas/graphblas.hpp>
+
+using namespace grb;
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_MODULE select_test_suite
+
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+namespace
+{
+    // | 1 1 - - |
+    // | 1 2 2 - |
+    // | - 2 3 3 |
+    // | - - 3 4 |
+    IndexArrayType      i_A = {0, 0, 1, 1, 1, 2, 2, 2, 3, 3};
+    IndexArrayType      j_A = {0, 1, 0, 1, 2, 1, 2, 3, 2, 3};
+    std::vector<double> v_A = {1, 1, 1, 2, 2, 2, 3, 3, 3, 4};
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(select_mat_test_bad_dimension)
+{
+    Matrix<double> A(4, 4);
+    A.build(i_A, j_A, v_A);
+
+    {
+        Matrix<double> C(3, 4);
+        BOOST_CHECK_THROW(
+            (select(C, NoMask(), NoAccumulate(), TriL(), A)),
+            DimensionException);
+    }
+    {
+        Matrix<double> C(4, 3);
+        BOOST_CHECK_THROW(
+            (select(C, NoMask(), NoAccumulate(), TriL(), A)),
+            DimensionException);
+    }
+    {
+        Matrix<double> C(4, 4);
+        Matrix<bool> M(4, 3);
+        BOOST_CHECK_THROW(
+            (select(C, M, NoAccumulate(), TriL(), A)),
+            DimensionException);
+    }
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(select_mat_test_tril_triu)
+{
+    Matrix<double> A(4, 4);
+    A.build(i_A, j_A, v_A);
+
+    std::vector<std::vector<double>> L_dense = {{1, 0, 0, 0},
+                                                {1, 2, 0, 0},
+                                                {0, 2, 3, 0},
+                                                {0, 0, 3, 4}};
+    Matrix<double> L_ans(L_dense, 0.);
+
+    std::vector<std::vector<double>> SU_dense = {{0, 1, 0, 0},
+                                                 {0, 0, 2, 0},
+                                                 {0, 0, 0, 3},
+                                                 {0, 0, 0, 0}};
+    Matrix<double> SU_ans(SU_dense, 0.);
+
+    Matrix<double> L(4, 4), U(4, 4);
+    select(L, NoMask(), NoAccumulate(), TriL(), A);
+    BOOST_CHECK_EQUAL(L, L_ans);
+
+    select(U, NoMask(), NoAccumulate(), TriU(1), A);
+    BOOST_CHECK_EQUAL(U, SU_ans);
+
+    // split() is built on select
+    Matrix<double> L2(4, 4), U2(4, 4);
+    split(A, L2, U2);
+    BOOST_CHECK_EQUAL(L2, L_ans);
+    BOOST_CHECK_EQUAL(U2, SU_ans);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(select_mat_test_diag_offdiag)
+{
+    Matrix<double> A(4, 4);
+    A.build(i_A, j_A, v_A);
+
+    std::vector<std::vector<double>> D_dense = {{1, 0, 0, 0},
+                                                {0, 2, 0, 0},
+                                                {0, 0, 3, 0},
+                                                {0, 0, 0, 4}};
+    Matrix<double> D_ans(D_dense, 0.);
+
+    std::vector<std::vector<double>> O_dense = {{0, 1, 0, 0},
+                                                {1, 0, 2, 0},
+                                                {0, 2, 0, 3},
+                                                {0, 0, 3, 0}};
+    Matrix<double> O_ans(O_dense, 0.);
+
+    std::vector<std::vector<double>> SD_dense = {{0, 0, 0, 0},
+                                                 {1, 0, 0, 0},
+                                                 {0, 2, 0, 0},
+                                                 {0, 0, 3, 0}};
+    Matrix<double> SD_ans(SD_dense, 0.);
+
+    Matrix<double> C(4, 4);
+    select(C, NoMask(), NoAccumulate(), Diag(), A);
+    BOOST_CHECK_EQUAL(C, D_ans);
+
+    select(C, NoMask(), NoAccumulate(), OffDiag(), A);
+    BOOST_CHECK_EQUAL(C, O_ans);
+
+    select(C, NoMask(), NoAccumulate(), Diag(-1), A);
+    BOOST_CHECK_EQUAL(C, SD_ans);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(select_mat_test_value_and_row_range)
+{
+    Matrix<double> A(4, 4);
+    A.build(i_A, j_A, v_A);
+
+    std::vector<std::vector<double>> LE_dense = {{1, 1, 0, 0},
+                                                 {1, 2, 2, 0},
+                                                 {0, 2, 0, 0},
+                                                 {0, 0, 0, 0}};
+    Matrix<double> LE_ans(LE_dense, 0.);
+
+    std::vector<std::vector<double>> GT_dense = {{0, 0, 0, 0},
+                                                 {0, 0, 0, 0},
+                                                 {0, 0, 3, 3},
+                                                 {0, 0, 3, 4}};
+    Matrix<double> GT_ans(GT_dense, 0.);
+
+    std::vector<std::vector<double>> R_dense = {{0, 0, 0, 0},
+                                                {1, 2, 2, 0},
+                                                {0, 2, 3, 3},
+                                                {0, 0, 0, 0}};
+    Matrix<double> R_ans(R_dense, 0.);
+
+    Matrix<double> C(4, 4);
+    select(C, NoMask(), NoAccumulate(), ValueLessEqual<double>(2), A);
+    BOOST_CHECK_EQUAL(C, LE_ans);
+
+    select(C, NoMask(), NoAccumulate(), ValueGreaterThan<double>(2), A);
+    BOOST_CHECK_EQUAL(C, GT_ans);
+
+    select(C, NoMask(), NoAccumulate(), RowRange(1, 3), A);
+    BOOST_CHECK_EQUAL(C, R_ans);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(select_mat_test_user_predicate_transpose)
+{
+    // | - 1 - - |
+    // | 5 - 2 - |
+    // | - - - 3 |
+    IndexArrayType      i = {0, 1, 1, 2};
+    IndexArrayType      j = {1, 0, 2, 3};
+    std::vector<double> v = {1, 5, 2, 3};
+    Matrix<double> A(3, 4);
+    A.build(i, j, v);
+
+    // Keep A'(i,j) where value > i + j
+    auto pred = [](double val, IndexType ii, IndexType jj)
+                { return val > static_cast<double>(ii + jj); };
+
+    // A' = | - 5 - |
+    //      | 1 - - |
+    //      | - 2 - |
+    //      | - - 3 |
+    std::vector<std::vector<double>> ans_dense = {{0, 5, 0},
+                                                  {0, 0, 0},
+                                                  {0, 0, 0},
+                                                  {0, 0, 0}};
+    Matrix<double> answer(ans_dense, 0.);
+
+    Matrix<double> C(4, 3);
+    select(C, NoMask(), NoAccumulate(), pred, transpose(A));
+    BOOST_CHECK_EQUAL(C, answer);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(select_mat_test_mask_accum)
+{
+    Matrix<double> A(4, 4);
+    A.build(i_A, j_A, v_A);
+
+    // C starts as all 10's on the diagonal
+    IndexArrayType      d = {0, 1, 2, 3};
+    std::vector<double> ten = {10, 10, 10, 10};
+    Matrix<double> C(4, 4);
+    C.build(d, d, ten);
+
+    // Mask selects the first two rows
+    std::vector<std::vector<bool>> M_dense = {{1, 1, 1, 1},
+                                              {1, 1, 1, 1},
+                                              {0, 0, 0, 0},
+                                              {0, 0, 0, 0}};
+    Matrix<bool> M(M_dense, false);
+
+    std::vector<std::vector<double>> ans_dense = {{11,  0,  0,  0},
+                                                  { 1, 12,  0,  0},
+                                                  { 0,  0, 10,  0},
+                                                  { 0,  0,  0, 10}};
+    Matrix<double> answer(ans_dense, 0.);
+
+    select(C, M, Plus<double>(), TriL(), A);
+    BOOST_CHECK_EQUAL(C, answer);
+
+    // With replace, the unmasked rows are cleared
+    std::vector<std::vector<double>> rep_dense = {{11,  0,  0,  0},
+                                                  { 1, 12,  0,  0},
+                                                  { 0,  0,  0,  0},
+                                                  { 0,  0,  0,  0}};
+    Matrix<double> rep_answer(rep_dense, 0.);
+
+    Matrix<double> C2(4, 4);
+    C2.build(d, d, ten);
+    select(C2, M, Plus<double>(), TriL(), A, REPLACE);
+    BOOST_CHECK_EQUAL(C2, rep_answer);
+}
+
+//****************************************************************************
+BOOST_AUTO_TEST_CASE(select_vec_test)
+{
+    std::vector<double> u_dense = {1, 0, 3, 4, 0, 6};
+    Vector<double> u(u_dense, 0.);
+
+    {
+        Vector<double> w(5);
+        BOOST_CHECK_THROW(
+            (select(w, NoMask(), NoAccumulate(), RowRange(0, 3), u)),
+            DimensionException);
+    }
+
+    {
+        std::vector<double> ans_dense = {0, 0, 3, 4, 0, 0};
+        Vector<double> answer(ans_dense, 0.);
+        Vector<double> w(6);
+        select(w, NoMask(), NoAccumulate(), RowRange(1, 4), u);
+        BOOST_CHECK_EQUAL(w, answer);
+    }
+
+    {
+        std::vector<double> ans_dense = {0, 0, 0, 4, 0, 6};
+        Vector<double> answer(ans_dense, 0.);
+        Vector<double> w(6);
+        select(w, NoMask(), NoAccumulate(), ValueGreaterEqual<double>(4), u);
+        BOOST_CHECK_EQUAL(w, answer);
+    }
+
+    {
+        std::vector<bool> m_dense = {true, true, true, false, false, false};
+        Vector<bool> m(m_dense, false);
+        std::vector<double> w_dense = {9, 9, 9, 9, 9, 9};
+        Vector<double> w(w_dense);
+        std::vector<double> ans_dense = {1, 0, 3, 9, 9, 9};
+        Vector<double> answer(ans_dense, 0.);
+        select(w, m, NoAccumulate(), ValueNotEqual<double>(6), u);
+        BOOST_CHECK_EQUAL(w, answer);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
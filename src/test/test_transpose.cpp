@@ -329,4 +329,93 @@ BOOST_AUTO_TEST_CASE(test_transpose_nonsquare_trans)
     }
 }
 
+//****************************************************************************
+// The masked write-back only visits rows that can change: check the rows it
+// skips (empty result row, empty mask row) against replace and merge.
+BOOST_AUTO_TEST_CASE(test_transpose_masked_row_skipping)
+{
+    // | 5 - 7 |T   | 5 6 - |
+    // | 6 - - |  = | - - - |
+    // | - - 8 |    | 7 - 8 |
+    std::vector<std::vector<double>> Atmp = {{5, 0, 7},
+                                             {6, 0, 0},
+                                             {0, 0, 8}};
+    Matrix<double, DirectedMatrixTag> A(Atmp, 0.0);
+
+    std::vector<std::vector<double>> Ctmp = {{1, 1, 0},
+                                             {0, 2, 0},
+                                             {3, 0, 3}};
+
+    std::vector<std::vector<bool>> Mtmp = {{true,  false, false},
+                                           {false, false, false},
+                                           {false, true,  true}};
+    Matrix<bool, DirectedMatrixTag> M(Mtmp, false);
+
+    // Complemented mask, empty T row: row 1 of C must still be cleared
+    {
+        std::vector<std::vector<double>> ans = {{1, 6, 0},
+                                                {0, 0, 0},
+                                                {7, 0, 3}};
+        Matrix<double, DirectedMatrixTag> answer(ans, 0.);
+
+        Matrix<double, DirectedMatrixTag> C(Ctmp, 0);
+        transpose(C, complement(M), NoAccumulate(), A, MERGE);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+    {
+        std::vector<std::vector<double>> ans = {{0, 6, 0},
+                                                {0, 0, 0},
+                                                {7, 0, 0}};
+        Matrix<double, DirectedMatrixTag> answer(ans, 0.);
+
+        Matrix<double, DirectedMatrixTag> C(Ctmp, 0);
+        transpose(C, complement(M), NoAccumulate(), A, REPLACE);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+
+    // Empty mask row: merge keeps row 1 of C, replace clears it
+    {
+        std::vector<std::vector<double>> ans = {{5, 1, 0},
+                                                {0, 2, 0},
+                                                {3, 0, 8}};
+        Matrix<double, DirectedMatrixTag> answer(ans, 0.);
+
+        Matrix<double, DirectedMatrixTag> C(Ctmp, 0);
+        transpose(C, M, NoAccumulate(), A, MERGE);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+    {
+        std::vector<std::vector<double>> ans = {{5, 0, 0},
+                                                {0, 0, 0},
+                                                {0, 0, 8}};
+        Matrix<double, DirectedMatrixTag> answer(ans, 0.);
+
+        Matrix<double, DirectedMatrixTag> C(Ctmp, 0);
+        transpose(C, M, NoAccumulate(), A, REPLACE);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+
+    // Accumulate with an empty T row: row 1 of C is kept either way
+    {
+        std::vector<std::vector<double>> ans = {{ 1, 7, 0},
+                                                { 0, 2, 0},
+                                                {10, 0, 3}};
+        Matrix<double, DirectedMatrixTag> answer(ans, 0.);
+
+        Matrix<double, DirectedMatrixTag> C(Ctmp, 0);
+        transpose(C, complement(M), Plus<double>(), A, MERGE);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+    {
+        std::vector<std::vector<double>> ans = {{ 0, 7, 0},
+                                                { 0, 2, 0},
+                                                {10, 0, 0}};
+        Matrix<double, DirectedMatrixTag> answer(ans, 0.);
+
+        Matrix<double, DirectedMatrixTag> C(Ctmp, 0);
+        transpose(C, complement(M), Plus<double>(), A, REPLACE);
+        BOOST_CHECK_EQUAL(C, answer);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
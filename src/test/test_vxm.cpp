@@ -659,5 +659,78 @@ BOOST_AUTO_TEST_CASE(test_vxm_scmp_masked_a_transpose)
     BOOST_CHECK_EQUAL(result, answer);
 }
 
+//****************************************************************************
+// The boolean OR-AND semiring uses a specialized (packed) kernel; check that
+// stored false values and word boundaries are handled like the generic one.
+BOOST_AUTO_TEST_CASE(test_vxm_logical_bool)
+{
+    grb::IndexType const N(130);
+    grb::IndexArrayType i = {0,   0,  1,  1,   2, 129, 129, 64};
+    grb::IndexArrayType j = {0, 127, 63, 64, 128,   1, 129, 65};
+    std::vector<bool>   v = {true, true, false, true, true, true, true, true};
+
+    // A(row, col) and AT = A'
+    grb::Matrix<bool> A(N, N), AT(N, N);
+    A.build(i.begin(), j.begin(), v.begin(), i.size());
+    AT.build(j.begin(), i.begin(), v.begin(), i.size());
+
+    grb::Vector<bool> u(N);
+    u.setElement(0,   false);
+    u.setElement(63,  true);
+    u.setElement(64,  false);
+    u.setElement(127, true);
+    u.setElement(129, true);
+
+    // row 0: (F and F) or (T and T) = T; row 1: (F and T) or (T and F) = F
+    // row 2: no intersection; row 64: no intersection; row 129: T
+    grb::Vector<bool> ans(N);
+    ans.setElement(0,   true);
+    ans.setElement(1,   false);
+    ans.setElement(129, true);
+
+    grb::Vector<bool> w(N);
+    grb::vxm(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::LogicalSemiring<bool>(), u, AT);
+    BOOST_CHECK_EQUAL(w, ans);
+
+    w.clear();
+    grb::vxm(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::LogicalSemiring<bool>(), u, grb::transpose(A));
+    BOOST_CHECK_EQUAL(w, ans);
+}
+
+
+//****************************************************************************
+// ANY-PAIR only depends on structure: stored zeros still produce a one.
+BOOST_AUTO_TEST_CASE(test_vxm_any_pair)
+{
+    grb::IndexType const N(70);
+    grb::IndexArrayType i = {0,  0, 1,  2, 69};
+    grb::IndexArrayType j = {3, 68, 5, 69,  0};
+    std::vector<double> v = {0., 2., 4., 5.,  0.};
+
+    grb::Matrix<double> A(N, N), AT(N, N);
+    A.build(i.begin(), j.begin(), v.begin(), i.size());
+    AT.build(j.begin(), i.begin(), v.begin(), i.size());
+
+    grb::Vector<double> u(N);
+    u.setElement(3,  0.);
+    u.setElement(68, 7.);
+    u.setElement(0,  0.);
+
+    grb::Vector<int> ans(N);
+    ans.setElement(0,  1);
+    ans.setElement(69, 1);
+
+    grb::Vector<int> w(N);
+    grb::vxm(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::AnyPairSemiring<int>(), u, AT);
+    BOOST_CHECK_EQUAL(w, ans);
+
+    w.clear();
+    grb::vxm(w, grb::NoMask(), grb::NoAccumulate(),
+             grb::AnyPairSemiring<int>(), u, grb::transpose(A));
+    BOOST_CHECK_EQUAL(w, ans);
+}
 
 BOOST_AUTO_TEST_SUITE_END()